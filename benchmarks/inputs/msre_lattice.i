@@ -0,0 +1,96 @@
+# Generated 3D lattice of MSRE-like fuel channels in graphite for distributed mesh scaling
+# studies. With --distributed-mesh every rank only generates its own part of the mesh.
+
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 922
+  sss2_input = false
+  account_delayed = false
+[]
+
+[Problem]
+  type = EigenProblem
+  bx_norm = fiss_neutrons
+[]
+
+[Mesh]
+  [lattice]
+    type = MSRLatticeMeshGenerator
+    dim = 3
+    num_channels = 8
+    pitch = 5.08
+    fuel_width = 1.02
+    height = 170
+    nx_fuel = 2
+    nx_moder = 2
+    n_axial = 20
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  vacuum_boundaries = 'fuel_bottoms fuel_tops moder_bottoms moder_tops outer_wall'
+  create_temperature_var = false
+  eigen = true
+[]
+
+[Materials]
+  [fuel]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_fuel_'
+    interp_type = 'spline'
+    block = 'fuel'
+  []
+  [moder]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_mod_'
+    interp_type = 'spline'
+    block = 'moder'
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  eigen_tol = 1e-6
+  free_power_iterations = 2
+  normalization = fiss_neutrons
+  normal_factor = 1
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Postprocessors]
+  [k_eff]
+    type = VectorPostprocessorComponent
+    index = 0
+    vectorpostprocessor = k_vpp
+    vector_name = eigen_values_real
+  []
+  [fiss_neutrons]
+    type = ElmIntegTotFissNtsPostprocessor
+    execute_on = linear
+  []
+[]
+
+[VectorPostprocessors]
+  [k_vpp]
+    type = Eigenvalues
+    inverse_eigenvalue = true
+    contains_complete_history = true
+  []
+[]
+
+[Outputs]
+  perf_graph = true
+[]
@@ -0,0 +1,306 @@
+#!/usr/bin/env python3
+# This script runs the curated Moltres performance regression suite defined in
+# benchmarks.json, records timing, memory, and solver statistics for each case,
+# and compares them against stored JSON baselines.
+import argparse
+import json
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+MOLTRES_DIR = os.path.dirname(BENCH_DIR)
+
+# Objects injected into every run through the command line so that the
+# shipped inputs do not need to be modified
+INSTRUMENTATION_ARGS = [
+    "Reporters/moltres_bench_perf/type=PerfGraphReporter",
+    "Reporters/moltres_bench_perf/execute_on=final",
+    "Postprocessors/moltres_bench_nl_its/type=NumNonlinearIterations",
+    "Postprocessors/moltres_bench_l_its/type=NumLinearIterations",
+    "Postprocessors/moltres_bench_dofs/type=NumDOFs",
+    "Postprocessors/moltres_bench_mem/type=MemoryUsage",
+    "Postprocessors/moltres_bench_mem/mem_type=physical_memory",
+    "Postprocessors/moltres_bench_mem/mem_units=mebibytes",
+    "Postprocessors/moltres_bench_mem/value_type=max_process",
+    "Postprocessors/moltres_bench_mem/report_peak_value=true",
+    "Outputs/moltres_bench/type=JSON",
+    "Outputs/moltres_bench/execute_on='timestep_end final'",
+]
+
+# Metrics compared against the baseline. Larger is worse for all of them.
+COMPARED_METRICS = ["wall_time", "peak_rss_mb", "nonlinear_its", "linear_its"]
+
+
+def find_executable(moltres_dir):
+    """
+    Returns the first Moltres executable found in the repository root,
+    preferring optimized builds.
+    """
+    for method in ["opt", "oprof", "devel", "dbg"]:
+        exe = os.path.join(moltres_dir, "moltres-" + method)
+        if os.path.exists(exe):
+            return exe
+    sys.exit("Unable to find a Moltres executable in " + moltres_dir)
+
+
+def case_sizes(suite, case):
+    """
+    Returns the dictionary of mesh size names to command line arguments
+    for a benchmark case.
+    """
+    return case.get("sizes", suite["default_sizes"])
+
+
+def collect_sections(node, name, sections):
+    """
+    Walks a PerfGraphReporter graph and accumulates the total time, self
+    time, and number of calls of every section by name.
+
+    Parameters
+    ----------
+    node: dict
+        PerfGraphReporter node
+    name: str
+        Section name of the node
+    sections: dict
+        Accumulated section data
+    Returns
+    ----------
+    total: float
+        Total time (self and children) spent in the node
+    """
+    children_time = 0.
+    for key, value in node.items():
+        if isinstance(value, dict):
+            children_time += collect_sections(value, key, sections)
+    self_time = node.get("time", 0.)
+    total = self_time + children_time
+    data = sections.setdefault(
+        name, {"total_time": 0., "self_time": 0., "calls": 0})
+    data["total_time"] += total
+    data["self_time"] += self_time
+    data["calls"] += node.get("num_calls", 0)
+    return total
+
+
+def parse_json_output(file_name):
+    """
+    Extracts solver statistics and PerfGraph section timings from the
+    MOOSE JSON output written by the injected instrumentation.
+    """
+    with open(file_name) as f:
+        data = json.load(f)
+
+    results = {"nonlinear_its": 0, "linear_its": 0, "dofs": 0,
+               "moose_peak_mem_mb": 0., "sections": {}}
+
+    # The output on final repeats the values of the last time step, so only
+    # the last output of every time step is kept
+    steps = {}
+    for index, step in enumerate(data.get("time_steps", [])):
+        steps[step.get("time_step", index)] = step
+
+    for step in steps.values():
+        if "moltres_bench_nl_its" in step:
+            results["nonlinear_its"] += int(
+                step["moltres_bench_nl_its"]["value"])
+            results["linear_its"] += int(step["moltres_bench_l_its"]["value"])
+            results["dofs"] = int(step["moltres_bench_dofs"]["value"])
+            results["moose_peak_mem_mb"] = max(
+                results["moose_peak_mem_mb"],
+                step["moltres_bench_mem"]["value"])
+        if "moltres_bench_perf" in step:
+            graph = step["moltres_bench_perf"]["graph"]
+            for key, value in graph.items():
+                collect_sections(value, key, results["sections"])
+    return results
+
+
+def run_case(exe, name, case, size, args, mpi_procs, n_threads,
+             distributed_mesh, timeout):
+    """
+    Runs a single benchmark case at one mesh size and returns its metrics.
+    """
+    input_file = os.path.join(MOLTRES_DIR, case["input"])
+    work_dir = os.path.dirname(input_file)
+
+    command = []
+    if mpi_procs > 1:
+        command += ["mpiexec", "-n", str(mpi_procs)]
+
+    for setup in case.get("setup", []):
+        setup_input = os.path.join(MOLTRES_DIR, setup)
+        subprocess.run(command + [exe, "-i", os.path.basename(setup_input)],
+                       cwd=os.path.dirname(setup_input), check=True,
+                       stdout=subprocess.DEVNULL, timeout=timeout)
+
+    out_base = os.path.join(tempfile.mkdtemp(prefix="moltres_bench_"),
+                            name + "_" + size)
+    command += [exe, "-i", os.path.basename(input_file)]
+    if n_threads > 1:
+        command += ["--n-threads=" + str(n_threads)]
+    if distributed_mesh:
+        command += ["--distributed-mesh"]
+    command += INSTRUMENTATION_ARGS
+    command += ["Outputs/moltres_bench/file_base=" + out_base]
+    command += case.get("args", []) + args
+
+    print("Running " + name + " (" + size + "): " +
+          " ".join(shlex.quote(c) for c in command))
+    start = time.perf_counter()
+    proc = subprocess.Popen(command, cwd=work_dir, stdout=subprocess.DEVNULL)
+    try:
+        _, status, usage = os.wait4(proc.pid, 0)
+    except KeyboardInterrupt:
+        proc.kill()
+        raise
+    wall_time = time.perf_counter() - start
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode != 0:
+        print("  " + name + " (" + size + ") failed with exit code " +
+              str(proc.returncode))
+        return None
+
+    results = parse_json_output(out_base + ".json")
+    results["wall_time"] = wall_time
+    # Under mpiexec, the resource usage of the child process is that of the
+    # launcher, so the peak memory of the largest rank comes from MemoryUsage.
+    # Otherwise ru_maxrss (in kilobytes on Linux) also covers the memory
+    # allocated after the last MemoryUsage evaluation.
+    results["peak_rss_mb"] = results["moose_peak_mem_mb"]
+    if mpi_procs == 1:
+        results["peak_rss_mb"] = max(usage.ru_maxrss / 1024.,
+                                     results["peak_rss_mb"])
+    results["mpi_procs"] = mpi_procs
+    results["n_threads"] = n_threads
+    return results
+
+
+def compare(results, baseline, threshold):
+    """
+    Compares benchmark results against a baseline and returns a list of
+    regression messages.
+    """
+    regressions = []
+    for key, result in sorted(results.items()):
+        if key not in baseline:
+            print("  " + key + ": no baseline")
+            continue
+        for metric in COMPARED_METRICS:
+            old = baseline[key].get(metric)
+            new = result.get(metric)
+            if not old or new is None:
+                continue
+            change = (new - old) / old
+            line = "  {:45s} {:14s} {:12.4g} -> {:12.4g} ({:+.1%})".format(
+                key, metric, old, new, change)
+            print(line)
+            if change > threshold:
+                regressions.append(line)
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run the Moltres performance regression benchmarks.")
+    parser.add_argument("--suite", default=os.path.join(
+        BENCH_DIR, "benchmarks.json"), help="Benchmark suite definition.")
+    parser.add_argument("--exe", help="Moltres executable to benchmark.")
+    parser.add_argument("--cases", nargs="+",
+                        help="Subset of cases to run (default: all).")
+    parser.add_argument("--sizes", nargs="+", default=["small"],
+                        help="Mesh sizes to run (small, medium, large).")
+    parser.add_argument("-n", "--mpi-procs", type=int, nargs="+", default=[1],
+                        help="Numbers of MPI processes to run each case with.")
+    parser.add_argument("--n-threads", type=int, nargs="+", default=[1],
+                        help="Thread counts to run each case with.")
+    parser.add_argument("--distributed-mesh", action="store_true",
+                        help="Run with a distributed instead of a replicated "
+                        "mesh.")
+    parser.add_argument("--baseline", default=os.path.join(
+        BENCH_DIR, "baselines", "baseline.json"),
+        help="Baseline JSON file to compare against or update.")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="Store the results as the new baseline.")
+    parser.add_argument("--threshold", type=float,
+                        help="Relative increase flagged as a regression.")
+    parser.add_argument("--output", help="Write the results to this file.")
+    parser.add_argument("--timeout", type=float, default=None,
+                        help="Timeout in seconds for setup runs.")
+    args = parser.parse_args()
+
+    with open(args.suite) as f:
+        suite = json.load(f)
+    threshold = args.threshold if args.threshold is not None \
+        else suite.get("threshold", 0.1)
+    exe = os.path.abspath(args.exe) if args.exe else \
+        find_executable(MOLTRES_DIR)
+
+    results = {}
+    failures = []
+    for name, case in suite["cases"].items():
+        if args.cases and name not in args.cases:
+            continue
+        sizes = case_sizes(suite, case)
+        for size in args.sizes:
+            if size not in sizes:
+                continue
+            for mpi_procs in args.mpi_procs:
+                for n_threads in args.n_threads:
+                    key = name + "/" + size
+                    if mpi_procs > 1:
+                        key += "/n" + str(mpi_procs)
+                    if n_threads > 1:
+                        key += "/t" + str(n_threads)
+                    if args.distributed_mesh:
+                        key += "/distributed"
+                    result = run_case(exe, name, case, size, sizes[size],
+                                      mpi_procs, n_threads,
+                                      args.distributed_mesh, args.timeout)
+                    if result is None:
+                        failures.append(key)
+                    else:
+                        result["physics"] = case.get("physics", "")
+                        result["distributed_mesh"] = args.distributed_mesh
+                        results[key] = result
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+
+    if args.update_baseline:
+        baseline = {}
+        if os.path.exists(args.baseline):
+            with open(args.baseline) as f:
+                baseline = json.load(f)
+        baseline.update(results)
+        os.makedirs(os.path.dirname(os.path.abspath(args.baseline)),
+                    exist_ok=True)
+        with open(args.baseline, "w") as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+        print("Updated baseline " + args.baseline)
+        return 1 if failures else 0
+
+    regressions = []
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        print("Comparison against " + args.baseline +
+              " (threshold {:.0%}):".format(threshold))
+        regressions = compare(results, baseline, threshold)
+    else:
+        print("No baseline found at " + args.baseline)
+
+    for failure in failures:
+        print("FAILED: " + failure)
+    for regression in regressions:
+        print("REGRESSION:" + regression)
+    return 1 if failures or regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
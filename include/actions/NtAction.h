@@ -2,6 +2,10 @@
 
 #include "VariableNotAMooseObjectAction.h"
 
+#include <functional>
+
+class NuclearMaterial;
+
 /**
  * Add neutronics kernels and variables to MSR simulations automatically.
  * When writing the multigroup diffusion equation:
@@ -27,6 +31,12 @@ public:
 
   virtual void act() override;
 
+  virtual std::map<SubdomainName, unsigned int> elementCosts() const override;
+
+  virtual bool hasConstantOperators(std::string & reason) const override;
+
+  virtual std::vector<VariableName> variableNames() const override;
+
 protected:
   /// number of precursor groups
   unsigned int _num_precursor_groups;
@@ -37,6 +47,10 @@ protected:
   /// number of energy groups
   unsigned int _num_groups;
 
+  /// Adds the group flux variables and their kernels, boundary conditions and auxiliary objects
+  /// for the current task
+  void addGroupObjects();
+
   /**
   * Adds non-source neutronics kernel
   *
@@ -68,4 +82,23 @@ protected:
   * @param var_name The name of the variable the kernel acts on
   */
   void addDelayedNeutronSource(const unsigned & op, const std::string & var_name);
+
+  /**
+   * Restricts a kernel to the blocks on which it does not vanish with the group constants of the
+   * nuclear materials and on which its coupled variables are defined, and reports the blocks it
+   * was pruned from
+   *
+   * @param params The parameters of the kernel, whose blocks are restricted
+   * @param kernel_name The name of the kernel
+   * @param vanishes Whether the kernel vanishes with the group constants of a nuclear material
+   * @param coupled_vars Variables of the kernel that may only be defined on some of its blocks
+   * @return Whether the kernel is left on any block and should be added
+   */
+  bool pruneKernelBlocks(InputParameters & params,
+                         const std::string & kernel_name,
+                         const std::function<bool(const NuclearMaterial &)> & vanishes,
+                         const std::vector<VariableName> & coupled_vars = {});
+
+  /// Name of the ElementMatrixCache added with cache_element_matrices
+  UserObjectName elementMatrixCacheName() const;
 };
@@ -24,6 +24,12 @@ public:
 
   virtual void act() override;
 
+  virtual std::map<SubdomainName, unsigned int> elementCosts() const override;
+
+  virtual bool hasConstantOperators(std::string & reason) const override;
+
+  virtual std::vector<VariableName> variableNames() const override;
+
 protected:
   using Action::addRelationshipManagers;
   void addRelationshipManagers(Moose::RelationshipManagerType when_type) override;
@@ -9,6 +9,27 @@ public:
 
   static InputParameters validParams();
 
+  /**
+   * Get the cost of the objects this action adds to each element, in numbers of coupled
+   * variable-kernel pairs. Used by MoltresWeightedPartitioner to balance the mesh partitions.
+   * @return Map of block names to costs. An empty block name stands for all blocks.
+   */
+  virtual std::map<SubdomainName, unsigned int> elementCosts() const { return {}; }
+
+  /**
+   * Whether the operators added by this action are linear with constant coefficients, so that
+   * their matrices can be assembled once and reused for the whole solve
+   * @param reason Set to why the operators are not constant
+   */
+  virtual bool hasConstantOperators(std::string & reason) const
+  {
+    reason = "the objects added by " + name() + " are not known to be constant";
+    return false;
+  }
+
+  /// The nonlinear variables added by this action
+  virtual std::vector<VariableName> variableNames() const { return {}; }
+
 protected:
   /**
    * Get the block ids from the input parameters
@@ -16,9 +37,66 @@ protected:
    */
   std::set<SubdomainID> getSubdomainIDs();
 
+  /**
+   * Get the scaling factor of the variables added by this action, from 'scaling' or, with
+   * scaling_mode = physical, from 'reference_value'
+   */
+  Real variableScaling() const;
+
+  /**
+   * Check that the automatic scaling of the executioner is enabled with scaling_mode = jacobian
+   * and does not override the factors of scaling_mode = physical. Called when each variable is
+   * added.
+   */
+  void checkAutomaticScaling() const;
+
+  /**
+   * Have the Jacobian assembled only once if the user declared the operators constant or, with
+   * constant_operators = auto, if the operators of every action and the properties of every
+   * material are constant, these actions add all of the nonlinear variables and the time step is
+   * fixed. Every action must ask for it alike. Only the Jacobian assembly is skipped, and a
+   * ConstantJacobianReset has it reassembled when the time step changes. Called once all objects
+   * have been added.
+   */
+  void setupConstantOperators();
+
+  /// Name of the ConstantJacobianReset shared by all the actions
+  static UserObjectName constantJacobianResetName();
+
+  /**
+   * Whether the properties of every material are the same at every evaluation, which the
+   * parameters of the actions cannot tell
+   * @param reason Set to why they are not
+   */
+  bool hasConstantMaterials(std::string & reason) const;
+
+  /**
+   * Whether the time derivative terms of the Jacobian stay the same from one time step to the
+   * next, which requires a constant time step and implicit Euler time integration. Always true
+   * for steady and eigenvalue executioners.
+   * @param reason Set to why they do not
+   */
+  bool hasConstantTimeStep(std::string & reason) const;
+
+  /**
+   * Whether a coupled variable parameter of this action was given a constant value rather than
+   * the name of a variable
+   */
+  bool isCoupledConstant(const std::string & param) const;
+
   /**
    * Add a variable
    * @param var_name The variable name
    */
   void addVariable(const std::string & var_name);
+
+  /**
+   * Add a nonlinear variable, numbering its degrees of freedom as chosen by dof_ordering
+   * @param type The variable type
+   * @param var_name The variable name
+   * @param params The variable parameters
+   */
+  void addNonlinearVariable(const std::string & type,
+                            const std::string & var_name,
+                            InputParameters & params);
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AuxKernel.h"
+#include "GammaHeatProfile.h"
 
 /**
  * When a reactor runs, gamma rays are emitted in extraordinary quantity.
@@ -12,7 +13,8 @@
  * user-defined proportionality factor (usually between 2 and 10 percent).
  *
  * Gamma can define a form factor for the gamma heating. That is, gamma heating can be set to be
- * cosinusoidal or Bessel.
+ * cosinusoidal or Bessel. It is evaluated once per quadrature point and time step, see
+ * GammaHeatProfile, or can be given as a precomputed field instead.
  */
 class ModeratorHeatSourceTransientAux : public AuxKernel
 {
@@ -21,9 +23,19 @@ public:
 
   static InputParameters validParams();
 
+  virtual void meshChanged() override;
+
 protected:
   virtual Real computeValue() override;
 
   const PostprocessorValue & _average_fission_heat;
-  const Function & _gamma;
+
+  /// Gamma field, if the gamma heating shape is given as a variable
+  const VariableValue * const _gamma_field;
+
+  /// Cached gamma profile, if it is given as a function
+  GammaHeatProfile _gamma;
+
+  /// Gamma at the quadrature points of the current element, or at the current node
+  const std::vector<Real> * _gamma_values;
 };
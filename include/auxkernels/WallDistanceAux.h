@@ -1,6 +1,8 @@
 #pragma once
 
 #include "AuxKernel.h"
+#include "KDTree.h"
+#include "PerfGuard.h"
 
 /*
  * Computes the minimum wall distance of the element from the wall boundaries.
@@ -12,8 +14,29 @@ public:
 
   WallDistanceAux(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
 protected:
   virtual Real computeValue() override;
 
+  /// Collects the positions of all wall boundary nodes and builds the search tree over them
+  void updateWallPoints();
+
+  /// Distance from the current node to the closest wall boundary node
+  Real minWallDistance();
+
   std::vector<BoundaryName> _wall_boundary_names;
+
+  /// Maximum number of points in a leaf of the search tree
+  const unsigned int _max_leaf_size;
+
+  /// Positions of the wall boundary nodes
+  std::vector<Point> _wall_points;
+
+  /// Search tree over the wall boundary nodes, queried for the closest wall node of each node
+  std::unique_ptr<KDTree> _wall_tree;
+
+  /// Section timing the search tree construction, attributed to the turbulence
+  const PerfID _update_timer;
 };
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "InputParameters.h"
+
+class ElementMatrixCache;
+class MooseObject;
+class UserObjectInterface;
+
+/**
+ * Gives the neutronics kernels access to an optional ElementMatrixCache, from which they assemble
+ * their Jacobian as a group constant times a cached element matrix when the group constant is
+ * uniform over the element.
+ */
+class ElementMatrixCacheInterface
+{
+public:
+  ElementMatrixCacheInterface(const MooseObject & moose_object,
+                              const UserObjectInterface & user_object_interface);
+
+  static InputParameters validParams();
+
+protected:
+  /// The cache of element matrices, or nullptr to always integrate the Jacobian
+  const ElementMatrixCache * const _element_matrix_cache;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "InputParameters.h"
+#include "MooseArray.h"
+
+#include <unordered_map>
+
+class Function;
+
+/**
+ * Evaluates the spatial profile of the gamma heating, gamma(t, x), at the quadrature points of an
+ * element (or at a node) and caches the values, so that a parsed function is evaluated once per
+ * quadrature point and time rather than once per test function and nonlinear iteration.
+ *
+ * The values are reused for the whole simulation if the profile is time independent or separable,
+ * gamma(t, x) = f(t) s(x), in which case only f is evaluated at each time. Otherwise they are
+ * reused while the time does not change, i.e. over the nonlinear iterations of a time step.
+ *
+ * The cache holds one entry per element (or node) visited by the owning object on its thread,
+ * i.e. about (n_qp + 8) Reals per local element, and is cleared when the mesh changes. It can be
+ * turned off with cache_gamma = false.
+ */
+class GammaHeatProfile
+{
+public:
+  GammaHeatProfile(const InputParameters & parameters,
+                   const Function * shape,
+                   const Function * time_factor);
+
+  static InputParameters validParams();
+
+  /**
+   * Get the gamma values at the given points
+   * @param id The id of the element (or node) the points belong to, used as the cache key
+   * @param points The quadrature points
+   * @param n_points The number of quadrature points
+   * @param t The current time
+   */
+  const std::vector<Real> &
+  values(dof_id_type id, const MooseArray<Point> & points, unsigned int n_points, Real t);
+
+  /// Drops all cached values, e.g. when the mesh changed
+  void clearCache() { _cached_values.clear(); }
+
+private:
+  struct CachedValues
+  {
+    Real time;
+    std::vector<Real> values;
+  };
+
+  /// The (spatial) profile
+  const Function * const _shape;
+
+  /// The time dependence of a separable profile, if any
+  const Function * const _time_factor;
+
+  /// Whether the profile values are cached
+  const bool _cache;
+
+  /// Whether the cached profile values stay valid when the time changes
+  const bool _cache_over_time;
+
+  /// Cached profile values at the quadrature points, by element or node id
+  std::unordered_map<dof_id_type, CachedValues> _cached_values;
+
+  /// The returned values, the cached profile multiplied by the time factor
+  std::vector<Real> _values;
+
+  /// Time at which the time factor was last evaluated, and its value
+  Real _factor_time;
+  Real _factor;
+};
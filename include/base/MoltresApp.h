@@ -11,6 +11,9 @@ public:
 
   virtual ~MoltresApp();
 
+  /// Runs the simulation and optionally prints the Moltres timing summary (--moltres-timing)
+  virtual void run() override;
+
   static void registerApps();
   static void registerAll(Factory & f, ActionFactory & af, Syntax & s);
 };
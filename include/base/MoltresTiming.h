@@ -0,0 +1,70 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "PerfGuard.h"
+
+class MooseApp;
+
+/**
+ * Registers PerfGraph sections for Moltres specific code and tags each of them with the physics it
+ * belongs to, so that the time spent in XS parsing, action object generation etc. can be
+ * reported separately from the generic framework sections. Time a scope
+ * with
+ *
+ *   PerfGuard guard(_app.perfGraph(), _construct_timer);
+ *
+ * where _construct_timer was obtained from MoltresTiming::registerSection(). The PerfGraph also
+ * counts how often each section was entered. Work that is too fine grained for a PerfGraph
+ * section, such as the per side work of a postprocessor, is instead timed by the object itself and
+ * added to an accumulator obtained from MoltresTiming::registerAccumulator().
+ */
+namespace MoltresTiming
+{
+enum Physics
+{
+  NEUTRONICS = 0,
+  PRECURSORS,
+  THERMAL,
+  TURBULENCE,
+  NUM_PHYSICS
+};
+
+/// Name of a physics category as used in the section names and the summary
+const std::string & physicsName(Physics physics);
+
+/**
+ * Registers (or looks up, if already registered) the section "Moltres::<physics>::<name>"
+ *
+ * @param physics The physics the section is attributed to in the summary
+ * @param name The section name, typically Class::method
+ * @param level The PerfGraph level of the section
+ * @param live_message The message printed by the live PerfGraph output while in the section
+ */
+PerfID registerSection(Physics physics,
+                       const std::string & name,
+                       unsigned int level,
+                       const std::string & live_message = "");
+
+/**
+ * Registers (or looks up, if already registered) an accumulated timer reported in the summary as
+ * "<name>" under its physics
+ *
+ * @param physics The physics the time is attributed to in the summary
+ * @param name The timer name, typically Class::method(object name)
+ * @return The id to pass to accumulate()
+ */
+std::size_t registerAccumulator(Physics physics, const std::string & name);
+
+/**
+ * Adds time measured by an object to an accumulated timer
+ *
+ * @param id The id returned by registerAccumulator()
+ * @param seconds The time spent
+ * @param calls The number of calls the time was spent in
+ */
+void accumulate(std::size_t id, Real seconds, unsigned long calls);
+
+/// Prints the time and number of calls of every registered Moltres section and accumulated timer,
+/// grouped by physics
+void printSummary(MooseApp & app, std::ostream & out);
+}
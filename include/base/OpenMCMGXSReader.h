@@ -0,0 +1,44 @@
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <map>
+
+/**
+ * Reads the group constants of a multigroup cross section library written by OpenMC
+ * (openmc.MGXSLibrary.export_to_hdf5, or openmc.mgxs.Library.create_mg_library). The library
+ * holds one group of data per material (xsdata) and temperature, "<xsdata>/<T>K".
+ *
+ * The group constants are returned under the names used by the Moltres materials and in the same
+ * form as python/moltres_xs.py writes them from the OpenMC tallies:
+ * - GTRANSFXS is the P0 nu-scattering matrix, ordered by incoming group,
+ * - REMXS is the absorption plus the out-scattering,
+ * - DIFFCOEF is 1 / (3 transport cross section), with the transport correction of the P1
+ *   scattering moments if the library holds them,
+ * - FISSE is the energy per fission in MeV,
+ * - delayed data given per energy group are collapsed with the nu-fission (BETA_EFF) and the
+ *   delayed neutron fractions (CHI_D).
+ *
+ * Reading a library requires libMesh to be configured with HDF5.
+ */
+class OpenMCMGXSReader
+{
+public:
+  OpenMCMGXSReader(const std::string & file_name);
+
+  /// Temperatures at which the library holds data for a material
+  std::vector<Real> temperatures(const std::string & xsdata) const;
+
+  /// Get the group constants of a material at a temperature
+  std::map<std::string, std::vector<Real>> groupConstants(const std::string & xsdata,
+                                                          Real temperature) const;
+
+  unsigned int numGroups() const { return _num_groups; }
+  unsigned int numDelayedGroups() const { return _num_delayed_groups; }
+
+private:
+  const std::string _file_name;
+
+  unsigned int _num_groups;
+  unsigned int _num_delayed_groups;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <map>
+
+/**
+ * Reads the group constants of a Serpent 2 results file (<input>_res.m). The file holds one block
+ * of results per universe, branch and burnup step, in which every quantity is written as
+ *
+ *   NAME (idx, [1: n]) = [ value error value error ... ];
+ *
+ * The group constants of a block are returned under the names used by the Moltres materials, in
+ * the same form as python/moltres_xs.py writes them: the relative errors and, for the delayed
+ * neutron data, the totals over all precursor groups are dropped.
+ */
+class SerpentResReader
+{
+public:
+  SerpentResReader(const std::string & file_name);
+
+  /**
+   * Get the group constants of a universe at a branch and burnup step
+   * @param universe The name of the universe (GC_UNIVERSE_NAME)
+   * @param branch The index of the branch (COEF_IDX), starting at 1
+   * @param burnup_step The burnup step (BURN_STEP), 0 without depletion
+   */
+  std::map<std::string, std::vector<Real>>
+  groupConstants(const std::string & universe, unsigned int branch, unsigned int burnup_step) const;
+
+  /// Number of result blocks in the file
+  std::size_t numBlocks() const { return _universes.size(); }
+
+private:
+  /// Finds the block of a universe at a branch and burnup step
+  std::size_t findBlock(const std::string & universe,
+                        unsigned int branch,
+                        unsigned int burnup_step) const;
+
+  const std::string _file_name;
+
+  /// Numeric values of each quantity in each block, in the order of the blocks
+  std::map<std::string, std::vector<std::vector<Real>>> _values;
+
+  /// Universe, branch and burnup step of each block
+  std::vector<std::string> _universes;
+  std::vector<unsigned int> _branches;
+  std::vector<unsigned int> _burnup_steps;
+};
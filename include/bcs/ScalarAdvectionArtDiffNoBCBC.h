@@ -4,8 +4,10 @@
 #include "ScalarTransportBase.h"
 
 /**
- * This class computes the residual and Jacobian contributions for the
- * incompressible Navier-Stokes temperature (energy) equation.
+ * This class computes the boundary term of the artificial diffusion of
+ * ScalarAdvectionArtDiff on boundaries without a boundary condition. The
+ * element length and the velocity magnitude at each quadrature point are
+ * computed once per side.
  */
 class ScalarAdvectionArtDiffNoBCBC : public IntegratedBC, public ScalarTransportBase
 {
@@ -20,6 +22,12 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned jvar) override;
+  virtual void precalculateResidual() override;
+  virtual void precalculateJacobian() override;
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
+  /// Fills the element length and the velocity at each quadrature point of the current side
+  void computeStabilizationParameters();
 
   Real _scale;
   // Coupled variables
@@ -37,4 +45,14 @@ protected:
   VariableValue _w_def;
   Real _conc_scaling;
   Real _tau;
+
+  /// Whether the artificial diffusion only acts along the streamlines instead of isotropically
+  const bool _streamline;
+
+  /// Largest vertex distance of the current element
+  Real _hmax;
+
+  /// Velocity and its magnitude at each quadrature point of the current side
+  std::vector<RealVectorValue> _velocity;
+  std::vector<Real> _u_norm;
 };
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Control.h"
+
+/**
+ * Reuses the preconditioner (and optionally the Jacobian) across Newton iterations and time
+ * steps, and has it rebuilt only when a solve failed, when the linear iterations grow, when the
+ * group constants have changed too much since it was built, as measured by an XSChangeIndicator,
+ * or after a maximum number of time steps. Meant for slow transients in which the nuclear material
+ * properties barely change between time steps.
+ */
+class PreconditionerLaggingControl : public Control
+{
+public:
+  PreconditionerLaggingControl(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialSetup() override;
+  virtual void execute() override;
+
+protected:
+  /// Sets the PETSc lag of the preconditioner and of the Jacobian
+  void setLag(int lag);
+
+  /// Rebuild when the linear iterations exceed this factor times those right after a rebuild
+  const Real _linear_iteration_growth;
+
+  /// Change of the group constants in the last time step, and the accumulated change that
+  /// triggers a rebuild
+  const PostprocessorValue * const _xs_change;
+  const Real _xs_change_threshold;
+
+  /// Maximum number of time steps a preconditioner is reused for, 0 for no limit
+  const unsigned int _max_reuse_steps;
+
+  /// Whether to lag the Jacobian along with the preconditioner, only allowed with PJFNK
+  const bool _lag_jacobian;
+
+  bool _initialized;
+  unsigned int _steps_since_rebuild;
+  unsigned int _reference_linear_iterations;
+  Real _accumulated_xs_change;
+};
@@ -1,12 +1,14 @@
 #pragma once
 
-#include "DGKernel.h"
+#include "ADDGKernel.h"
 
 /**
  * Computes residual contributions of the turbulent diffusion term in the delayed neutron
- * precursor equation using the discontinuous Galerkin method
+ * precursor equation using the discontinuous Galerkin method. The Jacobian, including the
+ * dependence of the turbulent diffusion coefficient on the Spalart-Allmaras viscosity, the
+ * dynamic viscosity and the density, is obtained by automatic differentiation.
  */
-class DGTurbulentDiffusion : public DGKernel
+class DGTurbulentDiffusion : public ADDGKernel
 {
 public:
   static InputParameters validParams();
@@ -14,18 +16,18 @@ public:
   DGTurbulentDiffusion(const InputParameters & parameters);
 
 protected:
-  virtual Real computeQpResidual(Moose::DGResidualType type) override;
-  virtual Real computeQpJacobian(Moose::DGJacobianType type) override;
-  virtual Real computeQpOffDiagJacobian(Moose::DGJacobianType type, unsigned jvar) override;
+  virtual ADReal computeQpResidual(Moose::DGResidualType type) override;
 
-  Real _epsilon;
-  Real _sigma;
+  /// Turbulent diffusion coefficient from the Spalart-Allmaras viscosity
+  ADReal turbulentDiffusivity(const ADReal & mu_tilde, const ADReal & mu, const ADReal & rho) const;
+
+  const Real _epsilon;
+  const Real _sigma;
   const ADMaterialProperty<Real> & _mu;
   const ADMaterialProperty<Real> & _mu_nb;
   const ADMaterialProperty<Real> & _rho;
   const ADMaterialProperty<Real> & _rho_nb;
   const ADVariableValue & _mu_tilde;
   const ADVariableValue & _mu_tilde_nb;
-  Real _sc;
-  unsigned int _mu_tilde_var_number;
+  const Real _sc;
 };
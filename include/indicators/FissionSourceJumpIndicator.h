@@ -0,0 +1,41 @@
+#pragma once
+
+#include "InternalSideIndicator.h"
+#include "ScalarTransportBase.h"
+
+/**
+ * Computes the jump of the normal gradient of the fission neutron source
+ * \f$\sum_g \nu \Sigma_{f,g} \phi_g\f$ or of the fission power density
+ * \f$\sum_g \epsilon_{f,g} \Sigma_{f,g} \phi_g\f$ across element faces. Targets the elements where
+ * the power shape, and thus the peak power, is poorly resolved.
+ */
+class FissionSourceJumpIndicator : public InternalSideIndicator, public ScalarTransportBase
+{
+public:
+  static InputParameters validParams();
+
+  FissionSourceJumpIndicator(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpIntegral() override;
+
+  /// Gradient of the fission source on the element (neighbor = false) or neighbor side
+  RealVectorValue sourceGradient(bool neighbor);
+
+  const unsigned int _num_groups;
+
+  /// Whether to use the fission power density instead of the fission neutron source
+  const bool _power;
+
+  const MaterialProperty<std::vector<Real>> & _nsf;
+  const MaterialProperty<std::vector<Real>> & _neighbor_nsf;
+  const MaterialProperty<std::vector<Real>> & _fissxs;
+  const MaterialProperty<std::vector<Real>> & _neighbor_fissxs;
+  const MaterialProperty<std::vector<Real>> & _fisse;
+  const MaterialProperty<std::vector<Real>> & _neighbor_fisse;
+
+  std::vector<const VariableValue *> _group_fluxes;
+  std::vector<const VariableGradient *> _grad_group_fluxes;
+  std::vector<const VariableValue *> _neighbor_group_fluxes;
+  std::vector<const VariableGradient *> _neighbor_grad_group_fluxes;
+};
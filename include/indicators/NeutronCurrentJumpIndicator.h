@@ -0,0 +1,27 @@
+#pragma once
+
+#include "InternalSideIndicator.h"
+#include "ScalarTransportBase.h"
+
+/**
+ * Computes the jump of the normal neutron current \f$D_g \nabla \phi_g \cdot \hat{n}\f$ of a group
+ * flux across element faces. The current is continuous in the exact solution, also across
+ * material interfaces where the flux gradient itself jumps, so only the discretization error is
+ * picked up.
+ */
+class NeutronCurrentJumpIndicator : public InternalSideIndicator, public ScalarTransportBase
+{
+public:
+  static InputParameters validParams();
+
+  NeutronCurrentJumpIndicator(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpIntegral() override;
+
+  const MaterialProperty<std::vector<Real>> & _diffcoef;
+  const MaterialProperty<std::vector<Real>> & _neighbor_diffcoef;
+
+  /// Zero-based index of the group of the flux variable
+  const unsigned int _group;
+};
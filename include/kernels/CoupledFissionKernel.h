@@ -2,12 +2,15 @@
 
 #include "Kernel.h"
 #include "ScalarTransportBase.h"
+#include "ElementMatrixCacheInterface.h"
 
 /**
  * Computes fission source of neutrons without normalizing by
  * \f$ 1/k \f$. Note that this kernel is meant for transients.
  */
-class CoupledFissionKernel : public Kernel, public ScalarTransportBase
+class CoupledFissionKernel : public Kernel,
+                             public ScalarTransportBase,
+                             public ElementMatrixCacheInterface
 {
 public:
   CoupledFissionKernel(const InputParameters & parameters);
@@ -18,6 +21,22 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+  /// Cached Jacobian with respect to the flux of group g, if the fission production is uniform
+  /// over the element
+  bool computeCachedJacobian(unsigned int g, unsigned int jvar);
+
+  /// Fission neutrons from group g born in the group of this kernel, per unit flux
+  Real fissionYield(unsigned int g, unsigned int qp) const;
+
+  /// Derivative of the fission source with respect to a variable, given the derivatives of the
+  /// group constants with respect to it
+  Real fissionDerivative(const MaterialProperty<std::vector<Real>> & d_nsf,
+                         const MaterialProperty<std::vector<Real>> & d_chi_t,
+                         const MaterialProperty<std::vector<Real>> & d_chi_p,
+                         const MaterialProperty<Real> & d_beta);
 
   const MaterialProperty<std::vector<Real>> & _nsf;
   const MaterialProperty<std::vector<Real>> & _d_nsf_d_temp;
@@ -35,4 +54,11 @@ protected:
   std::vector<unsigned int> _flux_ids;
   bool _account_delayed;
   Real _eigenvalue_scaling;
+
+  /// Variables in 'xs_variables' and the derivatives of the group constants with respect to them
+  std::vector<unsigned int> _xs_var_ids;
+  std::vector<const MaterialProperty<std::vector<Real>> *> _d_nsf_d_xs_vars;
+  std::vector<const MaterialProperty<std::vector<Real>> *> _d_chi_t_d_xs_vars;
+  std::vector<const MaterialProperty<std::vector<Real>> *> _d_chi_p_d_xs_vars;
+  std::vector<const MaterialProperty<Real> *> _d_beta_d_xs_vars;
 };
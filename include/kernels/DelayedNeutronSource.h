@@ -18,8 +18,8 @@ protected:
   const MaterialProperty<std::vector<Real>> & _decay_constant;
   const MaterialProperty<std::vector<Real>> & _d_decay_constant_d_temp;
   unsigned int _group;
-  const MaterialProperty<std::vector<Real>> &  _chi_d;
-  // todo add the jacobian (it's going to be negligible tho)
+  const MaterialProperty<std::vector<Real>> & _chi_d;
+  const MaterialProperty<std::vector<Real>> & _d_chi_d_d_temp;
 
   unsigned int _num_precursor_groups;
   unsigned int _temp_id;
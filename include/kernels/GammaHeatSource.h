@@ -1,7 +1,13 @@
 #pragma once
 
 #include "Kernel.h"
+#include "GammaHeatProfile.h"
 
+/**
+ * Gamma heat source in the moderator, proportional to the average fission heat. The gamma
+ * profile is evaluated once per quadrature point before the test function loop, see
+ * GammaHeatProfile, or taken from a precomputed field.
+ */
 class GammaHeatSource : public Kernel
 {
 public:
@@ -9,10 +15,21 @@ public:
 
   static InputParameters validParams();
 
+  virtual void meshChanged() override;
+
 protected:
+  virtual void precalculateResidual() override;
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
 
   const PostprocessorValue & _average_fission_heat;
-  const Function & _gamma;
+
+  /// Gamma field, if the gamma heating shape is given as a variable
+  const VariableValue * const _gamma_field;
+
+  /// Cached gamma profile, if it is given as a function
+  GammaHeatProfile _gamma;
+
+  /// Gamma at the quadrature points of the current element
+  const std::vector<Real> * _gamma_values;
 };
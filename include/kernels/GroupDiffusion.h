@@ -2,8 +2,11 @@
 
 #include "Kernel.h"
 #include "ScalarTransportBase.h"
+#include "ElementMatrixCacheInterface.h"
 
-class GroupDiffusion : public Kernel, public ScalarTransportBase
+class GroupDiffusion : public Kernel,
+                       public ScalarTransportBase,
+                       public ElementMatrixCacheInterface
 {
 public:
   GroupDiffusion(const InputParameters & parameters);
@@ -14,9 +17,15 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeJacobian() override;
 
   const MaterialProperty<std::vector<Real>> & _diffcoef;
   const MaterialProperty<std::vector<Real>> & _d_diffcoef_d_temp;
   unsigned int _group;
   unsigned int _temp_id;
+
+  /// Variables in 'xs_variables' and the derivatives of the diffusion coefficients with respect
+  /// to them
+  std::vector<unsigned int> _xs_var_ids;
+  std::vector<const MaterialProperty<std::vector<Real>> *> _d_diffcoef_d_xs_vars;
 };
@@ -2,8 +2,9 @@
 
 #include "Kernel.h"
 #include "ScalarTransportBase.h"
+#include "ElementMatrixCacheInterface.h"
 
-class InScatter : public Kernel, public ScalarTransportBase
+class InScatter : public Kernel, public ScalarTransportBase, public ElementMatrixCacheInterface
 {
 public:
   InScatter(const InputParameters & parameters);
@@ -14,6 +15,14 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
+  /// Transfer cross section from group g to the group of this kernel
+  Real transferXS(unsigned int g, unsigned int qp) const;
+
+  /// Derivative of the in-scattering source with respect to a variable, given the derivatives
+  /// of the transfer cross sections with respect to it
+  Real scatteringDerivative(const MaterialProperty<std::vector<Real>> & d_gtransfxs);
 
   const MaterialProperty<std::vector<Real>> & _gtransfxs;
   const MaterialProperty<std::vector<Real>> & _d_gtransfxs_d_temp;
@@ -23,4 +32,9 @@ protected:
   std::vector<const VariableValue *> _group_fluxes;
   std::vector<unsigned int> _flux_ids;
   bool _sss2_input;
+
+  /// Variables in 'xs_variables' and the derivatives of the transfer cross sections with respect
+  /// to them
+  std::vector<unsigned int> _xs_var_ids;
+  std::vector<const MaterialProperty<std::vector<Real>> *> _d_gtransfxs_d_xs_vars;
 };
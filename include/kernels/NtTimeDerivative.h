@@ -1,8 +1,9 @@
 #pragma once
 
 #include "ScalarTransportTimeDerivative.h"
+#include "ElementMatrixCacheInterface.h"
 
-class NtTimeDerivative : public ScalarTransportTimeDerivative
+class NtTimeDerivative : public ScalarTransportTimeDerivative, public ElementMatrixCacheInterface
 {
 public:
   NtTimeDerivative(const InputParameters & parameters);
@@ -13,9 +14,15 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeJacobian() override;
 
   const MaterialProperty<std::vector<Real>> & _recipvel;
   const MaterialProperty<std::vector<Real>> & _d_recipvel_d_temp;
   unsigned int _group;
   unsigned int _temp_id;
+
+  /// Variables in 'xs_variables' and the derivatives of the inverse velocities with respect to
+  /// them
+  std::vector<unsigned int> _xs_var_ids;
+  std::vector<const MaterialProperty<std::vector<Real>> *> _d_recipvel_d_xs_vars;
 };
@@ -19,6 +19,18 @@
  * \f]
  * Ref: E. Onate & M. Manzan, 2000, "Stabilization Techniques for Finite
  * Element Analysis of Convection-Diffusion Problems".
+ *
+ * With stabilization = streamline_diffusion the same \f$\tau\f$ weights a
+ * diffusion that only acts along the streamlines:
+ * \f[
+ *   \tau_s (\vec{u} \cdot \nabla \psi_i) (\vec{u} \cdot \nabla c), \quad
+ *   \tau_s = \tau \frac{l_e}{2 |u|}.
+ * \f]
+ * This is not the consistent SUPG method: the perturbation only multiplies the
+ * advection term, not the full residual, so it still adds an O(h) error.
+ *
+ * The element length, velocity magnitude, Peclet number and \f$\tau\f$ are
+ * computed once per quadrature point before the test and trial function loops.
  */
 class ScalarAdvectionArtDiff : public Kernel, public ScalarTransportBase
 {
@@ -31,6 +43,17 @@ public:
 
 protected:
   virtual Real tau();
+  /// Derivative of tau with respect to the Peclet number
+  virtual Real tauDerivative();
+  virtual void precalculateResidual() override;
+  virtual void precalculateJacobian() override;
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
+  /// Fills the element length and the per quadrature point stabilization parameters
+  void computeStabilizationParameters();
+
+  /// Derivative of the streamline diffusion residual with respect to the velocity component comp
+  Real streamlineVelocityDerivative(unsigned int comp);
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned jvar) override;
@@ -51,5 +74,19 @@ protected:
   VariableValue _w_def;
   const MaterialProperty<Real> & _D;
   Real _conc_scaling;
-  const Real & _current_elem_volume;
+
+  /// Whether the artificial diffusion only acts along the streamlines instead of isotropically
+  const bool _streamline;
+
+  /// Element length of the current element
+  Real _h;
+
+  /// Velocity, its magnitude, the element Peclet number, tau, its derivative and the artificial
+  /// diffusivity at each quadrature point of the current element
+  std::vector<RealVectorValue> _velocity;
+  std::vector<Real> _u_norm;
+  std::vector<Real> _peclet;
+  std::vector<Real> _tau_qp;
+  std::vector<Real> _d_tau_qp;
+  std::vector<Real> _delta;
 };
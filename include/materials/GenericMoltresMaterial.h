@@ -13,6 +13,10 @@ public:
 
   static InputParameters validParams();
 
+  virtual std::size_t xsLibraryBytes() const override;
+
+  virtual bool hasConstantGroupConstants(std::string & reason) const override;
+
 protected:
   void Construct(std::string & property_tables_root);
   void bicubicSplineConstruct(std::string & property_tables_root,
@@ -24,6 +28,19 @@ protected:
   virtual void bicubicSplineComputeQpProperties();
   virtual void leastSquaresComputeQpProperties();
 
+  /**
+   * Evaluates the least squares polynomial of one group constant entry by Horner's scheme
+   * @param coefs The fit coefficients of the group constant, indexed by coefficient then entry
+   * @param entry The group (or group pair / precursor group) index
+   * @param x The fit variable of the temperature
+   * @param y The fit variable of the other temperature, unused for single variable fits
+   * @param d_dx The derivative of the polynomial with respect to x
+   */
+  Real evaluateLeastSquaresFit(const std::vector<std::vector<Real>> & coefs,
+                               unsigned int entry,
+                               Real x,
+                               Real y,
+                               Real & d_dx) const;
 
   const PostprocessorValue & _other_temp;
   const PostprocessorValue & _peak_power_density;
@@ -35,4 +52,23 @@ protected:
 
   std::string _material;
   bool _perform_control;
+
+  // Degrees of the least squares polynomials in the temperature and in other_temp
+  const unsigned int _lsq_degree;
+  const unsigned int _lsq_other_degree;
+
+  // Whether the least squares polynomials are in the logarithm of the temperatures over
+  // lsq_reference_temperature
+  const bool _lsq_log;
+  const Real _lsq_reference_temperature;
+
+  // A least squares fitted group constant with its properties and a factor for unit conversion
+  struct LeastSquaresFit
+  {
+    const std::vector<std::vector<Real>> * coefs;
+    MaterialProperty<std::vector<Real>> * property;
+    MaterialProperty<std::vector<Real>> * temperature_derivative;
+    Real factor;
+  };
+  std::vector<LeastSquaresFit> _lsq_fits;
 };
@@ -11,7 +11,16 @@ public:
   static InputParameters validParams();
 
 protected:
-  void Construct(nlohmann::json xs_root);
+  void Construct(const nlohmann::json & material);
+
+  // Parse only the requested material and group constants of a JSON file
+  nlohmann::json readJson(const std::string & base_file);
+
+  // Read the group constants of a Serpent 2 results file or an OpenMC MGXS library into the
+  // layout of the JSON files
+  nlohmann::json readSerpent(const std::string & base_file);
+  nlohmann::json readOpenMC(const std::string & base_file);
+
   virtual void computeQpProperties() override;
 
   // Vector of group constants to be loaded
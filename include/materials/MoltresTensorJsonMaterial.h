@@ -0,0 +1,100 @@
+#pragma once
+
+#include "NuclearMaterial.h"
+
+/**
+ * Interpolates group constants tabulated on a tensor product grid over any number of state
+ * variables, e.g. fuel temperature, moderator temperature, salt density and control rod
+ * insertion. Each axis of the grid is driven by the temperature, another coupled variable or a
+ * postprocessor. The interpolation is multilinear or multicubic (cubic Hermite along each axis).
+ *
+ * Per quadrature point, the bracketing interval and the 1D interpolation weights are computed
+ * once per axis and shared by all group constants, which are stored contiguously at each grid
+ * point so that the tensor product sum runs over all of them at once. The same sum with the
+ * derivative weights of one axis gives the partial derivatives with respect to the coupled
+ * variable of that axis: d_<property>_d_temp for the temperature and d_<property>_d_<variable>
+ * for the other coupled variables.
+ */
+class MoltresTensorJsonMaterial : public NuclearMaterial
+{
+public:
+  MoltresTensorJsonMaterial(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual std::size_t xsLibraryBytes() const override;
+
+  virtual bool hasConstantGroupConstants(std::string & reason) const override;
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// Reads the grid and the group constants of the material from the JSON file
+  void readTable(const std::string & base_file);
+
+  /// Computes the first stencil index and the interpolation weights (and their derivatives) along
+  /// an axis at the given value
+  void computeAxisWeights(unsigned int axis, Real value);
+
+  /// Computes the tensor product sum over the stencil with the weights of _stencil_weights
+  void tensorProductSum(std::vector<Real> & result);
+
+  /// Copies the interpolated entries into the group constant properties
+  void scatter(const std::vector<MaterialProperty<std::vector<Real>> *> & properties,
+               const std::vector<Real> & entries);
+
+  /// A grid axis and what drives it
+  struct Axis
+  {
+    std::string name;
+    std::vector<Real> points;
+    const VariableValue * variable;
+    const PostprocessorValue * postprocessor;
+    /// Index of the derivative properties of the coupled variable, or -1 for none
+    int derivative_index;
+  };
+  std::vector<Axis> _axes;
+
+  /// Whether to interpolate with cubic Hermite polynomials instead of linearly
+  const bool _cubic;
+
+  /// Number of stencil points along each axis
+  const unsigned int _stencil_size;
+
+  /// Strides of the axes in the flattened grid
+  std::vector<std::size_t> _strides;
+
+  /// Group constants at each grid point, all entries of a grid point stored contiguously
+  std::vector<Real> _table;
+
+  /// Number of entries per grid point, and offset and length of each group constant in them in
+  /// _xsec_names order
+  std::size_t _entries_per_point;
+  std::vector<std::size_t> _offsets;
+  std::vector<unsigned int> _lengths;
+
+  /// Group constant properties in _xsec_names order and their temperature derivatives
+  std::vector<MaterialProperty<std::vector<Real>> *> _xs_properties;
+  std::vector<MaterialProperty<std::vector<Real>> *> _xs_temp_derivatives;
+
+  /// Derivatives of the group constants with respect to the other coupled variables
+  std::vector<std::vector<MaterialProperty<std::vector<Real>> *>> _xs_var_derivatives;
+
+  /// Derivatives of the total delayed neutron fraction with respect to the other coupled
+  /// variables, and the index of BETA_EFF in _xsec_names
+  std::vector<MaterialProperty<Real> *> _d_beta_d_vars;
+  const std::size_t _beta_eff_index;
+
+  /// Per axis first stencil index, weights and derivative weights at the current point
+  std::vector<std::size_t> _first_index;
+  std::vector<std::vector<Real>> _weights;
+  std::vector<std::vector<Real>> _d_weights;
+
+  /// Weights of each axis in the current tensor product sum and stencil position of the sum
+  std::vector<const std::vector<Real> *> _stencil_weights;
+  std::vector<std::size_t> _stencil_digits;
+
+  /// Interpolated entries and their derivatives at the current point
+  std::vector<Real> _values;
+  std::vector<Real> _derivatives;
+};
@@ -40,6 +40,7 @@ protected:
   MaterialProperty<std::vector<Real>> & _d_recipvel_d_temp;
   MaterialProperty<std::vector<Real>> & _d_chi_t_d_temp;
   MaterialProperty<std::vector<Real>> & _d_chi_p_d_temp;
+  MaterialProperty<std::vector<Real>> & _d_chi_d_d_temp;
   MaterialProperty<std::vector<Real>> & _d_gtransfxs_d_temp;
   MaterialProperty<std::vector<Real>> & _d_beta_eff_d_temp;
   MaterialProperty<Real> & _d_beta_d_temp;
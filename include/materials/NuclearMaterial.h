@@ -25,10 +25,13 @@
  * "special interpolations"
  * none :           no interpolation is done. The cross section value for each group is read from
  *                  the first temperature row in the interpolation table
- * least_squares :  user should have performed a linear least squares fit on cross section data
+ * least_squares :  user should have performed a least squares fit on cross section data
  *                  and should supply interpolation table with each row corresponding to energy
- *                  group. Each row should have two columns corresponding to 'a' and 'b' where
- *                  xsec(T) = a * T + b
+ *                  group. For the default linear fit each row has two columns corresponding to
+ *                  'a' and 'b' where xsec(T) = a * T + b. Higher degree polynomials, in T or
+ *                  ln(T / T_ref) and optionally in a second temperature, list their coefficients
+ *                  from the highest power down (see GenericMoltresMaterial). They can be fitted
+ *                  with python/fit_least_squares_xs.py
  */
 class NuclearMaterial : public GenericConstantMaterial
 {
@@ -55,6 +58,20 @@ public:
                      " monotone_cubic=2 linear=3 none=4 least_squares=5");
   }
 
+  // returns the bytes used by one quadrature point value of the given property
+  std::size_t propertyBytes(const std::string & prop_name) const;
+
+  // returns the bytes held by the group constant tables, fit coefficients and interpolators
+  virtual std::size_t xsLibraryBytes() const;
+
+  // returns whether the given entry of a group constant is zero at every temperature. Materials
+  // that do not tabulate the group constant, or interpolate it bicubically, return false.
+  virtual bool isZeroGroupConstant(const std::string & xs_name, unsigned int entry) const;
+
+  // returns whether the group constants are the same at every evaluation, setting the reason if
+  // they are not
+  virtual bool hasConstantGroupConstants(std::string & reason) const;
+
 protected:
   virtual void dummyComputeQpProperties();
   virtual void splineComputeQpProperties();
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "NuclearMaterial.h"
+#include "FunctionParserUtils.h"
+
+/**
+ * Group constants given as parsed expressions of the temperature T and of other coupled variables,
+ * e.g. functional fits of a cross section library, instead of tabulated data. The temperature
+ * derivatives needed for the Jacobian are taken symbolically. The function parser returns one
+ * value per function, so each entry is parsed, JIT compiled unless enable_jit = false, and
+ * evaluated separately with its derivative. Entries that are plain numbers, and the group
+ * constants that are not given, are stored once instead.
+ */
+class ParsedXSMaterial : public NuclearMaterial, public FunctionParserUtils<false>
+{
+public:
+  ParsedXSMaterial(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+protected:
+  virtual void computeQpProperties() override;
+
+  /// A group constant with the parsed expression and temperature derivative of each entry
+  /// that is not a number
+  struct ParsedXS
+  {
+    MaterialProperty<std::vector<Real>> * property;
+    MaterialProperty<std::vector<Real>> * temperature_derivative;
+    /// Values of the entries that are numbers, and zero for the parsed entries
+    std::vector<Real> constants;
+    /// Indices of the parsed entries
+    std::vector<unsigned int> entries;
+    std::vector<SymFunctionPtr> functions;
+    std::vector<SymFunctionPtr> derivatives;
+  };
+
+  /// Parses an expression and its temperature derivative
+  void parseExpression(const std::string & param_name,
+                       const std::string & expression,
+                       SymFunctionPtr & function,
+                       SymFunctionPtr & derivative);
+
+  /// The parsed group constants
+  std::vector<ParsedXS> _parsed_xs;
+
+  /// Coupled variables that may appear in the expressions besides T
+  std::vector<const VariableValue *> _args;
+
+  /// Comma separated list of the expression variables, T first
+  std::string _variables;
+};
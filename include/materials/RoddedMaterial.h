@@ -1,20 +1,25 @@
 #pragma once
 
 #include "GenericMoltresMaterial.h"
-#include "ODEKernel.h"
+
+#include <unordered_map>
 
 /**
- * This class is meant to simulate a piece of material with a rod in it.
- * In the future, it is expected that better, more accurate code will be written;
- * this is a proof of concept to get pretty plots.
- *
- * The idea is to load material properties like any other moltres material,
- * but if the quadrature point is above control rod position, a greatly increased absorbtion
- * XS is returned.
+ * Group constants of a material with control rods in it. The group constants are loaded like
+ * those of any other moltres material, with any interp_type, and the removal cross section is
+ * scaled by absorb_factor where a rod is inserted, i.e. beyond the rod position along
+ * rodDimension.
  *
- * rodPosition : the scalar variable giving rod position
- * absorb_factor : how much to scale up REMXS by
+ * Each rod has its own position (a scalar variable) and covers the elements whose centroid lies
+ * within rod_radii of its axis, or the whole material if no rod_centers are given. The extent of
+ * each element along the rod is cached, so that the elements only need to be classified as
+ * rodded, unrodded or partially rodded again when a rod moves. By default each quadrature point
+ * is rodded or unrodded. With the optional cusping correction, the group constants of a partially
+ * rodded element are the volume weighted mix of the rodded and unrodded sets, which removes the
+ * spurious jumps in the rod worth (rod cusping) of this binary cut at the rod tip.
  *
+ * rodPosition : the scalar variables giving the rod positions
+ * absorb_factor : how much to scale up REMXS by in the rods
  */
 class RoddedMaterial : public GenericMoltresMaterial
 {
@@ -23,12 +28,47 @@ public:
 
   static InputParameters validParams();
 
+  virtual void meshChanged() override;
+
 protected:
-  void splineConstruct(std::string & property_tables_root, std::vector<std::string> xsec_names);
   virtual void computeQpProperties() override;
-  virtual void computeSplineAbsorbingQpProperties();
 
-  Real _absorb_factor;
-  const VariableValue & _rod_pos;
-  MooseEnum _rod_dim;
+  /// Rod and extent along the rods of an element, and its rodded fraction at the last rod position
+  struct RodCoverage
+  {
+    int rod;
+    Real lower;
+    Real upper;
+    Real position;
+    Real rodded_fraction;
+  };
+
+  /// Get the (cached) rod coverage of the current element, updated for the current rod position
+  const RodCoverage & elemCoverage();
+
+  /// Whether the current element, extending from lower to upper along the rod, is extruded along
+  /// the rod, so that its cross section across the rod is the same at any position along it
+  bool extrudedAlongRod(Real lower, Real upper) const;
+
+  /// Factor applied to the removal cross section in the rods
+  const std::vector<Real> _absorb_factors;
+
+  /// Positions of the rods
+  std::vector<const VariableValue *> _rod_pos;
+
+  /// Dimension the rods are parallel to
+  const unsigned int _rod_dim;
+
+  /// Lateral positions of the rod axes and radii of the rods, empty for a single rod everywhere
+  const std::vector<Point> _rod_centers;
+  const std::vector<Real> _rod_radii;
+
+  /// Whether to mix the rodded and unrodded group constants in partially rodded elements
+  const bool _cusping_correction;
+
+  /// Rod coverage of each element
+  std::unordered_map<dof_id_type, RodCoverage> _coverage;
+
+  /// Rod coverage of the current element
+  const RodCoverage * _current_coverage;
 };
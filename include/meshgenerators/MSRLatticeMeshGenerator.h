@@ -0,0 +1,58 @@
+#pragma once
+
+#include "MeshGenerator.h"
+
+/**
+ * Generates structured molten salt reactor lattice meshes of fuel channels in graphite, with the
+ * same block and sideset names as the gmsh lattice meshes (fuel, moder, fuel_tops, ...).
+ *
+ * In 2D (or RZ, with x as the radius) the lattice is a row of fuel strips, each followed by a
+ * moderator strip, as in 2d_lattice_structured.geo. In 3D it is a square array of square fuel
+ * channels centered in the lattice cells and extruded over the core height.
+ *
+ * With a distributed mesh every process only builds the elements it owns plus the layer of
+ * elements sharing a node with them, so the full mesh is never held by a single process.
+ */
+class MSRLatticeMeshGenerator : public MeshGenerator
+{
+public:
+  static InputParameters validParams();
+
+  MSRLatticeMeshGenerator(const InputParameters & parameters);
+
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Appends an interval of the given width and number of elements to the lateral grid
+  void addLateralInterval(Real width, unsigned int num_elems, bool fuel);
+
+  /// Mesh dimension
+  const unsigned int _dim;
+
+  /// Number of fuel channels along each lateral direction
+  const unsigned int _num_channels;
+
+  /// Lattice pitch
+  const Real _pitch;
+
+  /// Width of the fuel channels
+  const Real _fuel_width;
+
+  /// Core height
+  const Real _height;
+
+  /// Number of elements across each fuel channel, each moderator interval and the height
+  const unsigned int _nx_fuel;
+  const unsigned int _nx_moder;
+  const unsigned int _n_axial;
+
+  /// Block ids of the fuel and moderator
+  const SubdomainID _fuel_block_id;
+  const SubdomainID _moder_block_id;
+
+  /// Node coordinates along a lateral direction
+  std::vector<Real> _lateral_nodes;
+
+  /// Whether each element interval along a lateral direction lies in a fuel channel
+  std::vector<bool> _lateral_fuel;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "PetscExternalPartitioner.h"
+
+/**
+ * Partitions the mesh with an external graph partitioner, weighting each element by the cost of
+ * the variables and kernels acting on its subdomain. Fuel elements carry the group fluxes, the
+ * precursors and their DG face terms, while moderator elements often only carry the group fluxes
+ * and the temperature, so balancing the element count alone leaves the fuel heavy processes
+ * behind.
+ *
+ * The costs are taken from the Nt and Precursors actions and can be overridden per block, e.g.
+ * with weights proportional to measured assembly times.
+ */
+class MoltresWeightedPartitioner : public PetscExternalPartitioner
+{
+public:
+  MoltresWeightedPartitioner(const InputParameters & params);
+
+  static InputParameters validParams();
+
+  virtual std::unique_ptr<Partitioner> clone() const override;
+
+  virtual dof_id_type computeElementWeight(Elem & elem) override;
+
+protected:
+  virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
+
+  /// Builds the weights of the subdomains of the mesh being partitioned
+  void computeSubdomainWeights(const MeshBase & mesh);
+
+  /// Whether to add the element costs of the Moltres actions
+  const bool _use_action_costs;
+
+  /// Blocks with user supplied weights and their weights
+  const std::vector<SubdomainName> & _weighted_blocks;
+  const std::vector<dof_id_type> & _block_weights;
+
+  /// Weight of the elements on all subdomains that are not in _subdomain_weights
+  dof_id_type _default_weight;
+
+  /// Weights of the elements on each subdomain
+  std::unordered_map<SubdomainID, dof_id_type> _subdomain_weights;
+};
@@ -13,9 +13,24 @@ public:
 
   static InputParameters validParams();
 
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
 protected:
   virtual Real computeQpIntegral() override;
 
   // Weight variable
   const VariableValue & _weight;
+
+  /// Whether the side loop is timed, for the precursor outlet integrals of the Precursors action
+  const bool _timed;
+
+  /// Accumulated timer of the side loop, which is too fine grained for a PerfGraph section
+  const std::size_t _timer;
+
+  /// Time spent and sides integrated by this thread in the current evaluation
+  Real _execute_time;
+  unsigned long _execute_calls;
 };
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * Largest change over the last time step of the group constants, estimated from their
+ * temperature derivatives as |d_xs_d_temp * (T - T_old) / xs|, or of the temperature itself.
+ * Used to decide whether a preconditioner built at an earlier time step can still be reused.
+ */
+class XSChangeIndicator : public ElementPostprocessor
+{
+public:
+  XSChangeIndicator(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  using Postprocessor::getValue;
+  virtual Real getValue() const override;
+
+protected:
+  /// Whether to measure the relative group constant change or the temperature change
+  const bool _temperature_only;
+
+  const VariableValue & _temp;
+  const VariableValue & _temp_old;
+
+  /// Group constants and their temperature derivatives
+  std::vector<const MaterialProperty<std::vector<Real>> *> _xs;
+  std::vector<const MaterialProperty<std::vector<Real>> *> _d_xs_d_temp;
+
+  Real _max_change;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "GeneralReporter.h"
+
+#include <petscmat.h>
+
+class SystemBase;
+
+/**
+ * Estimates the memory used on each subdomain by the mesh, the variables (solution vectors and
+ * Jacobian rows), the material properties and the group constant libraries, summed over all
+ * processes. The entries are reported as four parallel vectors (category, subdomain, name and
+ * bytes) and are optionally printed as a table.
+ */
+class MemoryFootprintReporter : public GeneralReporter
+{
+public:
+  static InputParameters validParams();
+
+  MemoryFootprintReporter(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  /// Adds an entry holding the local bytes, which are summed over all processes in finalize()
+  void addEntry(const std::string & category,
+                const std::string & subdomain,
+                const std::string & name,
+                Real bytes);
+
+  /// Elements and nodes
+  void addMeshEntries();
+
+  /// The PETSc Jacobian of the nonlinear system, or nullptr if it has not been created
+  Mat jacobianMatrix() const;
+
+  /// Solution vector storage of the locally owned DOFs of each variable and, given the Jacobian,
+  /// the storage of its rows
+  void addVariableEntries(SystemBase & system, Mat jacobian);
+
+  /// Stateful material properties at every qp and per-thread scratch for all other properties
+  void addMaterialEntries();
+
+  /// Group constant tables and interpolators held by the NuclearMaterial objects
+  void addXSLibraryEntries();
+
+  /// Number of quadrature points on an element of the given type
+  unsigned int numQps(const Elem & elem);
+
+  /// Name used for a subdomain in the report
+  std::string subdomainName(SubdomainID sid) const;
+
+  /// Whether to print a table of the memory footprint to the console
+  const bool _print;
+
+  std::vector<std::string> & _category;
+  std::vector<std::string> & _subdomain;
+  std::vector<std::string> & _name;
+  std::vector<Real> & _bytes;
+
+  /// Cached number of quadrature points per element type
+  std::map<ElemType, unsigned int> _num_qps;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/**
+ * Has a Jacobian that is assembled once, with constant_operators in the Nt and Precursors actions,
+ * which add this object once they found the operators constant, reassembled at the first Newton iteration after the time step changes, for instance when a
+ * ConstantDT time stepper cuts the time step after a failed solve or to hit the end time. The time
+ * derivative terms of the Jacobian scale with the inverse of the time step.
+ */
+class ConstantJacobianReset : public GeneralUserObject
+{
+public:
+  ConstantJacobianReset(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// The time step the Jacobian was last assembled with, zero before the first assembly
+  Real _assembled_dt;
+
+  /// Whether the Jacobian is to be reassembled with the current time step
+  bool _reassembling;
+
+  /// Whether the reassembly has started in the current Newton iteration
+  bool _assembling;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "MooseTypes.h"
+#include "MooseArray.h"
+#include "MooseUtils.h"
+
+#include "libmesh/dense_matrix.h"
+#include "libmesh/threads.h"
+
+#include <unordered_map>
+
+/**
+ * Caches the mass and stiffness matrices of each element, which only depend on its geometry and
+ * on the shape functions. Kernels whose Jacobian is a group constant times one of these matrices
+ * when the group constant is uniform over the element, such as SigmaR or GroupDiffusion, add the
+ * scaled cached matrix to their local Jacobian instead of integrating it again. All the variables
+ * using one cache must share the same finite element type.
+ */
+class ElementMatrixCache : public GeneralUserObject
+{
+public:
+  ElementMatrixCache(const InputParameters & parameters);
+
+  static InputParameters validParams();
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  virtual void meshChanged() override;
+
+  /**
+   * The mass matrix \f$ \int \psi_i \phi_j \f$ of an element, integrated with the given shape
+   * functions on the first request for the element
+   */
+  const DenseMatrix<Real> & massMatrix(const Elem & elem,
+                                       const VariableTestValue & test,
+                                       const VariablePhiValue & phi,
+                                       const MooseArray<Real> & JxW,
+                                       const MooseArray<Real> & coord) const;
+
+  /**
+   * The stiffness matrix \f$ \int \nabla \psi_i \cdot \nabla \phi_j \f$ of an element, integrated
+   * with the given shape functions on the first request for the element
+   */
+  const DenseMatrix<Real> & stiffnessMatrix(const Elem & elem,
+                                            const VariableTestGradient & grad_test,
+                                            const VariablePhiGradient & grad_phi,
+                                            const MooseArray<Real> & JxW,
+                                            const MooseArray<Real> & coord) const;
+
+  /**
+   * Whether a coefficient is the same at all the quadrature points of the current element, up to
+   * round-off
+   * @param coef Functor giving the coefficient at a quadrature point
+   * @param value Set to the value of the coefficient
+   */
+  template <typename Functor>
+  static bool uniform(const Functor & coef, unsigned int n_qp, Real & value);
+
+protected:
+  struct ElementMatrices
+  {
+    DenseMatrix<Real> mass;
+    DenseMatrix<Real> stiffness;
+  };
+
+  /// Get the matrices of an element, creating empty ones on first use
+  ElementMatrices & elementMatrices(const Elem & elem) const;
+
+  /// The cached matrices by element id. Elements are never erased but on mesh changes, so
+  /// references into the map stay valid while other threads insert.
+  mutable std::unordered_map<dof_id_type, ElementMatrices> _matrices;
+  mutable Threads::spin_mutex _mutex;
+};
+
+template <typename Functor>
+bool
+ElementMatrixCache::uniform(const Functor & coef, unsigned int n_qp, Real & value)
+{
+  value = coef(0);
+  for (const auto qp : make_range(1u, n_qp))
+    if (!MooseUtils::absoluteFuzzyEqual(coef(qp), value, 1e-12 * std::abs(value)))
+      return false;
+  return true;
+}
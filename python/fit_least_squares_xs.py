@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# This script fits polynomials in the temperature (or its logarithm) to tabulated
+# group constants and writes the coefficient file used by GenericMoltresMaterial
+# with interp_type = least_squares. It reports the fit error of every group
+# constant against the tabulated temperature branches.
+import argparse
+import sys
+import numpy as np
+
+# Same order as the group constants read by GenericMoltresMaterial
+XSEC_NAMES = ["REMXS", "FISSXS", "NSF", "FISSE", "DIFFCOEF", "RECIPVEL",
+              "CHI_T", "CHI_P", "CHI_D", "GTRANSFXS", "BETA_EFF",
+              "DECAY_CONSTANT"]
+
+# File name suffixes of the group constants, as in GenericMoltresMaterial
+FILE_NAMES = {"REMXS": "REMXS", "NSF": "NSF", "DIFFCOEF": "DIFFCOEF",
+              "BETA_EFF": "BETA_EFF", "FISSXS": "FISSXS", "FISSE": "FISSE",
+              "RECIPVEL": "RECIPVEL", "CHI_T": "CHI", "CHI_P": "CHI",
+              "CHI_D": "CHI_D", "GTRANSFXS": "GTRANSFXS",
+              "DECAY_CONSTANT": "DECAY_CONSTANT"}
+SSS2_FILE_NAMES = dict(FILE_NAMES, FISSXS="FISS", FISSE="KAPPA",
+                       RECIPVEL="INVV", CHI_T="CHIT", CHI_P="CHIP",
+                       CHI_D="CHID", GTRANSFXS="SP0", DECAY_CONSTANT="LAMBDA")
+
+
+def design_matrix(x, y, degree, other_degree):
+    """
+    Columns in the order of the coefficient file: powers of x from the
+    highest down and, for each of these, powers of y from the highest down.
+    """
+    columns = [x**i * y**j for i in range(degree, -1, -1)
+               for j in range(other_degree, -1, -1)]
+    return np.vstack(columns).T
+
+
+def fit(table, args):
+    """
+    Fits every entry of a group constant table.
+
+    Parameters
+    ----------
+    table: numpy array
+        One row per temperature branch: the temperature, the other
+        temperature for two temperature fits, then the entries.
+    args: argparse.Namespace
+        Fit options.
+
+    Returns
+    ----------
+    coefs: numpy array
+        The coefficients of each entry, one row per entry.
+    errors: numpy array
+        The largest relative error of each entry over the branches.
+    """
+    n_temps = 2 if args.other_degree > 0 else 1
+    x = table[:, 0]
+    y = table[:, 1] if n_temps == 2 else np.zeros(len(x))
+    if args.log:
+        x = np.log(x / args.reference_temperature)
+        if n_temps == 2:
+            y = np.log(y / args.reference_temperature)
+    A = design_matrix(x, y, args.degree, args.other_degree)
+    if A.shape[0] < A.shape[1]:
+        sys.exit("There are fewer temperature branches than coefficients.")
+
+    values = table[:, n_temps:]
+    coefs = np.linalg.lstsq(A, values, rcond=None)[0].T
+    fitted = A @ coefs.T
+    scale = np.maximum(np.abs(values), np.finfo(float).tiny)
+    errors = np.where(values == 0, np.abs(fitted),
+                      np.abs(fitted - values) / scale).max(axis=0)
+    return coefs, errors
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Fit polynomials in the temperature to tabulated group "
+        "constants for interp_type = least_squares.")
+    parser.add_argument("property_tables_root",
+                        help="Root of the tabulated group constant files, "
+                        "as given to GenericMoltresMaterial")
+    parser.add_argument("output", help="Coefficient file to write")
+    parser.add_argument("--num-groups", type=int, required=True)
+    parser.add_argument("--num-precursor-groups", type=int, required=True)
+    parser.add_argument("--degree", type=int, default=1,
+                        help="Degree in the temperature (lsq_degree)")
+    parser.add_argument("--other-degree", type=int, default=0,
+                        help="Degree in the other temperature "
+                        "(lsq_other_degree). The tables then hold the other "
+                        "temperature in their second column.")
+    parser.add_argument("--log", action="store_true",
+                        help="Fit in ln(T / reference temperature) "
+                        "(lsq_log_temperature)")
+    parser.add_argument("--reference-temperature", type=float, default=1.,
+                        help="lsq_reference_temperature")
+    parser.add_argument("--sss2-input", action="store_true",
+                        help="Use the Serpent 2 file names")
+    args = parser.parse_args()
+
+    lengths = {name: args.num_groups for name in XSEC_NAMES}
+    lengths["GTRANSFXS"] = args.num_groups**2
+    lengths["BETA_EFF"] = args.num_precursor_groups
+    lengths["DECAY_CONSTANT"] = args.num_precursor_groups
+    file_names = SSS2_FILE_NAMES if args.sss2_input else FILE_NAMES
+    n_coefs = (args.degree + 1) * (args.other_degree + 1)
+
+    print("{:<16} {:>6} {:>14}".format("Group constant", "Entry",
+                                       "Max rel. error"))
+    with open(args.output, "w") as out:
+        for name in XSEC_NAMES:
+            file_name = args.property_tables_root + file_names[name] + ".txt"
+            try:
+                table = np.atleast_2d(np.loadtxt(file_name))
+            except OSError:
+                if name != "CHI_D":
+                    raise
+                # Delayed neutrons are born in the top group, as assumed by
+                # GenericMoltresMaterial when CHI_D is missing
+                coefs = np.zeros((lengths[name], n_coefs))
+                if lengths[name] > 0:
+                    coefs[0, -1] = 1
+                errors = np.zeros(lengths[name])
+            else:
+                coefs, errors = fit(table, args)
+                if coefs.shape[0] != lengths[name]:
+                    sys.exit("{} holds {} entries instead of {}.".format(
+                        file_name, coefs.shape[0], lengths[name]))
+            for entry, (row, error) in enumerate(zip(coefs, errors)):
+                out.write(" ".join("{:.10e}".format(c) for c in row) + "\n")
+                print("{:<16} {:>6} {:>14.3e}".format(name, entry + 1, error))
+
+
+if __name__ == "__main__":
+    main()
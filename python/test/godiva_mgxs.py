@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+# Exports the Godiva group constants of the OpenMC statepoints in this directory as an MGXS
+# library with openmc.MGXSLibrary. The library is tests/materials/godiva_mgxs.h5, which
+# MoltresJsonMaterial reads with xs_format = openmc in tests/materials/mjm_openmc.i.
+#
+# The tallies are the ones moltres_xs.py reduces to gold/godiva.json with godiva_openmc.inp:
+# - the total cross section is the total reaction rate of the diffusion coefficient tallies
+#   divided by their track length flux,
+# - the P1 scattering moments are the difference between the total cross section and the
+#   transport cross section of openmc.mgxs.DiffusionCoefficient, which moltres_xs.py writes as
+#   DIFFCOEF, so that 1 / (3 (total - P1)) gives the same diffusion coefficient,
+# - nu-fission is computed from the flux and nu-fission tally as in moltres_xs.py.
+#
+# Run from python/test with OpenMC v0.13.2 or later.
+import importlib
+import sys
+
+import numpy as np
+import openmc
+import openmc.mgxs as mgxs
+
+STATEPOINTS = {
+    900: ('statepoint_900_openmc.100.h5', 'summary_900.h5', 'godiva_openmc_900'),
+    1200: ('statepoint_1200_openmc.100.h5', 'summary_1200.h5', 'godiva_openmc_1200'),
+}
+GROUP_EDGES = [1e-5, 748.5, 5.5308e3, 24.7875e3, 0.4979e6, 2.2313e6, 20e6]
+NUM_DELAYED_GROUPS = 8
+MATERIAL_ID = 1
+
+
+def load_domain(statepoint, summary, module):
+    """Loads the group constant tallies of the fuel from a statepoint
+
+    Parameters
+    ----------
+    statepoint: str
+        Name of the statepoint file
+    summary: str
+        Name of the summary file
+    module: str
+        Name of the OpenMC model script that defined the tallies
+
+    Returns
+    -------
+    sp: openmc.StatePoint
+    domain: dict
+        openmc.mgxs objects of the fuel, loaded from the statepoint
+    """
+
+    sp = openmc.StatePoint(statepoint, autolink=False)
+    sp.link_with_summary(openmc.Summary(summary))
+    domain = importlib.import_module(module).domain_dict[MATERIAL_ID]
+    for xs in domain.values():
+        if isinstance(xs, mgxs.MGXS):
+            xs.load_from_statepoint(sp)
+    return sp, domain
+
+
+def nu_fission(sp):
+    """Returns nu-fission divided by the flux, ordered from the fastest group"""
+
+    df = sp.get_tally(name=str(MATERIAL_ID) + " tally").get_pandas_dataframe()
+    flux = np.array(df.loc[df["score"] == "flux"]["mean"])
+    production = np.array(df.loc[df["score"] == "nu-fission"]["mean"])
+    return (production / flux)[::-1]
+
+
+def total(domain):
+    """Returns the total cross section of the diffusion coefficient tallies, ordered from the
+    fastest group"""
+
+    tallies = domain["diffusioncoefficient"].tallies
+    rate = tallies["total"].get_values().flatten()
+    flux = tallies["flux (tracklength)"].get_values().flatten()
+    return (rate / flux)[::-1]
+
+
+def main():
+    groups = mgxs.EnergyGroups(np.array(GROUP_EDGES))
+    temperatures = sorted(STATEPOINTS)
+    xsdata = openmc.XSdata('fuel_mat', groups, temperatures=temperatures,
+                           num_delayed_groups=NUM_DELAYED_GROUPS)
+    xsdata.order = 1
+
+    for temperature in temperatures:
+        sp, domain = load_domain(*STATEPOINTS[temperature])
+        G = groups.num_groups
+
+        scatter = domain["scatterxs"].get_xs()
+        probability = domain["scatterprobmatrix"].get_xs()
+        sigma_t = total(domain)
+        transport = 1. / (3. * domain["diffusioncoefficient"].get_xs())
+        scatter_matrix = np.zeros((G, G, 2))
+        scatter_matrix[:, :, 0] = probability * scatter[:, np.newaxis]
+        scatter_matrix[:, :, 1] = np.diag(sigma_t - transport)
+
+        xsdata.set_total(sigma_t, temperature)
+        xsdata.set_absorption(domain["absorptionxs"].get_xs(), temperature)
+        xsdata.set_scatter_matrix(scatter_matrix, temperature)
+        xsdata.set_fission(domain["fissionxs"].get_xs(), temperature)
+        xsdata.set_kappa_fission(domain["kappafissionxs"].get_xs(),
+                                 temperature)
+        xsdata.set_nu_fission(nu_fission(sp), temperature)
+        xsdata.set_chi(domain["chi"].get_xs(), temperature)
+        xsdata.set_chi_prompt(domain["chiprompt"].get_xs(), temperature)
+        xsdata.set_chi_delayed(domain["chidelayed"].get_xs(), temperature)
+        xsdata.set_beta(domain["beta"].get_xs().flatten(), temperature)
+        xsdata.set_decay_rate(domain["decayrate"].get_xs().flatten(),
+                              temperature)
+        xsdata.set_inverse_velocity(domain["inversevelocity"].get_xs(),
+                                    temperature)
+
+    library = openmc.MGXSLibrary(groups, num_delayed_groups=NUM_DELAYED_GROUPS)
+    library.add_xsdata(xsdata)
+    library.export_to_hdf5('../../tests/materials/godiva_mgxs.h5')
+
+
+if __name__ == "__main__":
+    if float(openmc.__version__[2:]) < 13.2:
+        sys.exit("godiva_mgxs.py is compatible with OpenMC v0.13.2 or later "
+                 "only.")
+    sys.path.append('./')
+    main()
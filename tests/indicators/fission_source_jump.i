@@ -0,0 +1,109 @@
+# The group 1 flux |x - 0.25| has a kink on the face at x = 0.25 inside the fuel, and a continuous
+# gradient on the fuel/moderator interface at x = 0.5, where only the group constants jump.
+# Only the two fuel elements next to the kink are indicated, and marked for refinement (2), while
+# the moderator elements are neither indicated nor marked (1).
+
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  group_fluxes = 'group1 group2'
+  temperature = 922
+[]
+
+[Mesh]
+  [square]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 1
+  []
+  [fuel]
+    type = SubdomainBoundingBoxGenerator
+    input = square
+    bottom_left = '0 0 0'
+    top_right = '0.5 1 0'
+    block_id = 1
+    block_name = 'fuel'
+  []
+  [moder]
+    type = RenameBlockGenerator
+    input = fuel
+    old_block = '0'
+    new_block = 'moder'
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [group1]
+    [InitialCondition]
+      type = FunctionIC
+      function = 'abs(x - 0.25)'
+    []
+  []
+  [group2]
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_fuel_'
+    interp_type = 'spline'
+    block = 'fuel'
+  []
+  [moder]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_mod_'
+    interp_type = 'spline'
+    block = 'moder'
+  []
+[]
+
+[Adaptivity]
+  marker = power_fraction
+  steps = 0
+  [Indicators]
+    [power_jump]
+      type = FissionSourceJumpIndicator
+      variable = group1
+      source = power
+    []
+  []
+  [Markers]
+    [power_fraction]
+      type = ErrorFractionMarker
+      indicator = power_jump
+      refine = 0.5
+    []
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Postprocessors]
+  [jump_moder]
+    type = ElementIntegralVariablePostprocessor
+    variable = power_jump
+    block = 'moder'
+  []
+  [marker_fuel]
+    type = ElementIntegralVariablePostprocessor
+    variable = power_fraction
+    block = 'fuel'
+  []
+  [marker_moder]
+    type = ElementIntegralVariablePostprocessor
+    variable = power_fraction
+    block = 'moder'
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
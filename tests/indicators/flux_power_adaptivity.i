@@ -0,0 +1,194 @@
+# Eigenvalue problem of a 1D fuel slab with a graphite reflector, reflected at x = 0 and with a
+# vacuum boundary at x = 130 cm, refined twice where the thermal neutron current or the fission
+# power density are poorly resolved. The precursors do not flow, so that each precursor group
+# holds beta_i / lambda_i times the element average of the fission neutron source divided by k.
+#
+# The gold holds k, the peak element average power density and the mesh size of each adaptivity
+# step, computed by hand with linear finite elements. The first step refines the two moderator
+# elements next to the fuel for the current and the two fuel elements next to the moderator for
+# the power, and the second step the halves of the moderator and fuel elements at the interface.
+
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  pre_concs = 'pre1 pre2 pre3 pre4 pre5 pre6'
+  temperature = 922
+  sss2_input = false
+  account_delayed = true
+[]
+
+[Problem]
+  type = EigenProblem
+  bx_norm = fiss_neutrons
+  kernel_coverage_check = false
+[]
+
+[Mesh]
+  [slab]
+    type = CartesianMeshGenerator
+    dim = 1
+    dx = '100 30'
+    ix = '10 3'
+    subdomain_id = '0 1'
+  []
+  [blocks]
+    type = RenameBlockGenerator
+    input = slab
+    old_block = '0 1'
+    new_block = 'fuel moder'
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  vacuum_boundaries = 'right'
+  create_temperature_var = false
+  pre_blocks = 'fuel'
+  eigen = true
+[]
+
+[Precursors]
+  [pres]
+    var_name_base = pre
+    outlet_boundaries = 'left'
+    u_def = 0
+    v_def = 0
+    w_def = 0
+    nt_exp_form = false
+    loop_precursors = false
+    family = MONOMIAL
+    order = CONSTANT
+    block = 'fuel'
+    transient = false
+    eigen = true
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_fuel_'
+    interp_type = 'spline'
+    block = 'fuel'
+  []
+  [moder]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_mod_'
+    interp_type = 'spline'
+    block = 'moder'
+  []
+[]
+
+[AuxVariables]
+  [power_density]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [power_density]
+    type = FissionHeatSourceTransientAux
+    variable = power_density
+    execute_on = timestep_end
+  []
+[]
+
+[Adaptivity]
+  steps = 2
+  marker = combo
+  max_h_level = 2
+  [Indicators]
+    [current_jump]
+      type = NeutronCurrentJumpIndicator
+      variable = group2
+      group_number = 2
+    []
+    [power_jump]
+      type = FissionSourceJumpIndicator
+      variable = group1
+      source = power
+    []
+  []
+  [Markers]
+    [current_fraction]
+      type = ErrorFractionMarker
+      indicator = current_jump
+      refine = 0.3
+    []
+    [power_fraction]
+      type = ErrorFractionMarker
+      indicator = power_jump
+      refine = 0.3
+    []
+    [combo]
+      type = ComboMarker
+      markers = 'current_fraction power_fraction'
+    []
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  initial_eigenvalue = 1
+  eigen_tol = 1e-10
+  normalization = power
+  normal_factor = 1e3
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Postprocessors]
+  [k_eff]
+    type = VectorPostprocessorComponent
+    index = 0
+    vectorpostprocessor = k_vpp
+    vector_name = eigen_values_real
+  []
+  [fiss_neutrons]
+    type = ElmIntegTotFissNtsPostprocessor
+    block = 'fuel'
+    execute_on = linear
+    outputs = none
+  []
+  [power]
+    type = ElmIntegTotFissHeatPostprocessor
+    execute_on = linear
+    outputs = none
+  []
+  [peak_power]
+    type = ElementExtremeValue
+    variable = power_density
+    execute_on = timestep_end
+  []
+  [elements]
+    type = NumElems
+    execute_on = timestep_end
+  []
+  [dofs]
+    type = NumDOFs
+    execute_on = timestep_end
+  []
+[]
+
+[VectorPostprocessors]
+  [k_vpp]
+    type = Eigenvalues
+    inverse_eigenvalue = true
+    outputs = none
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
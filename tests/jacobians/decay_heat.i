@@ -0,0 +1,179 @@
+# Coupled neutron diffusion, advected decay heat precursors and temperature with temperature
+# dependent group constants, for checking the hand coded Jacobian with random initial conditions
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = temp
+  sss2_input = true
+  account_delayed = false
+  decay_heat_fractions = '.01 .01 .01'
+  decay_heat_constants = '1 .1 .01'
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  jac_test = true
+[]
+
+[Variables]
+  [temp]
+  []
+  [heat1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [heat2]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [heat3]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[ICs]
+  [temp_ic]
+    type = RandomIC
+    variable = temp
+    min = 700
+    max = 1100
+  []
+  [heat1_ic]
+    type = RandomIC
+    variable = heat1
+  []
+  [heat2_ic]
+    type = RandomIC
+    variable = heat2
+  []
+  [heat3_ic]
+    type = RandomIC
+    variable = heat3
+  []
+[]
+
+[Kernels]
+  [temp_time_derivative]
+    type = MatINSTemperatureTimeDerivative
+    variable = temp
+  []
+  [temp_diffusion]
+    type = MatDiffusion
+    diffusivity = 'k'
+    variable = temp
+  []
+  [temp_source]
+    type = TransientFissionHeatSource
+    variable = temp
+    account_decay_heat = true
+    num_decay_heat_groups = 3
+    heat_concs = 'heat1 heat2 heat3'
+  []
+  [decay_heat1_source]
+    type = HeatPrecursorSource
+    variable = heat1
+    decay_heat_group_number = 1
+  []
+  [decay_heat1_decay]
+    type = HeatPrecursorDecay
+    variable = heat1
+    decay_heat_group_number = 1
+  []
+  [decay_heat2_source]
+    type = HeatPrecursorSource
+    variable = heat2
+    decay_heat_group_number = 2
+  []
+  [decay_heat2_decay]
+    type = HeatPrecursorDecay
+    variable = heat2
+    decay_heat_group_number = 2
+  []
+  [decay_heat3_source]
+    type = HeatPrecursorSource
+    variable = heat3
+    decay_heat_group_number = 3
+  []
+  [decay_heat3_decay]
+    type = HeatPrecursorDecay
+    variable = heat3
+    decay_heat_group_number = 3
+  []
+[]
+
+[DGKernels]
+  [decay_heat1_convection]
+    type = DGConvection
+    variable = heat1
+    velocity = '0 1 0'
+  []
+  [decay_heat2_convection]
+    type = DGConvection
+    variable = heat2
+    velocity = '0 1 0'
+  []
+  [decay_heat3_convection]
+    type = DGConvection
+    variable = heat3
+    velocity = '0 1 0'
+  []
+[]
+
+[BCs]
+  [decay_heat1_outflow]
+    type = OutflowBC
+    variable = heat1
+    velocity = '0 1 0'
+    boundary = 'top'
+  []
+  [decay_heat2_outflow]
+    type = OutflowBC
+    variable = heat2
+    velocity = '0 1 0'
+    boundary = 'top'
+  []
+  [decay_heat3_outflow]
+    type = OutflowBC
+    variable = heat3
+    velocity = '0 1 0'
+    boundary = 'top'
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = MoltresJsonMaterial
+    base_file = '../materials/xsdata.json'
+    material_key = 'fuel'
+    interp_type = 'spline'
+    prop_names = 'k cp rho'
+    prop_values = '.0553 1967 2.146e-3'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1e-3
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
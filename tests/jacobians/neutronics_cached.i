@@ -0,0 +1,51 @@
+# Transient neutron diffusion at a uniform temperature, so that the group constants are uniform
+# over every element and the Jacobian of the neutronics kernels is assembled from the cached
+# element matrices
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 900
+  sss2_input = true
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  cache_element_matrices = true
+  jac_test = true
+[]
+
+[Materials]
+  [fuel]
+    type = MoltresJsonMaterial
+    base_file = '../materials/xsdata.json'
+    material_key = 'fuel'
+    interp_type = 'linear'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1e-3
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
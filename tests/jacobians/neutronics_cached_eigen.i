@@ -0,0 +1,62 @@
+# Neutron diffusion eigenvalue problem at a uniform temperature, so that the Jacobian of the
+# neutronics kernels is assembled from the cached element matrices
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 900
+  sss2_input = true
+  account_delayed = false
+[]
+
+[Problem]
+  type = EigenProblem
+  bx_norm = fiss_neutrons
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  vacuum_boundaries = 'left right top bottom'
+  create_temperature_var = false
+  eigen = true
+  cache_element_matrices = true
+  jac_test = true
+[]
+
+[Materials]
+  [fuel]
+    type = MoltresJsonMaterial
+    base_file = '../materials/xsdata.json'
+    material_key = 'fuel'
+    interp_type = 'linear'
+  []
+[]
+
+[Postprocessors]
+  [fiss_neutrons]
+    type = ElmIntegTotFissNtsPostprocessor
+    execute_on = linear
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
@@ -0,0 +1,99 @@
+# Coupled neutron diffusion and temperature with the group constants of parsed_xs.i, for checking
+# the symbolic temperature derivatives of ParsedXSMaterial with random initial conditions
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = temp
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  jac_test = true
+[]
+
+[Variables]
+  [temp]
+  []
+[]
+
+[ICs]
+  [temp_ic]
+    type = RandomIC
+    variable = temp
+    min = 700
+    max = 1100
+  []
+[]
+
+[Kernels]
+  [temp_time_derivative]
+    type = MatINSTemperatureTimeDerivative
+    variable = temp
+  []
+  [temp_diffusion]
+    type = MatDiffusion
+    diffusivity = 'k'
+    variable = temp
+  []
+  [temp_source]
+    type = TransientFissionHeatSource
+    variable = temp
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = ParsedXSMaterial
+    constant_names = 'T0 rho_ratio_coef'
+    constant_expressions = '922 ${fparse -1.8 * 1.18e-4}'
+    nsf = 'rho:=exp(rho_ratio_coef*(T-T0));(3.18e-3-3.46e-4*log(T/T0))*rho
+           rho:=exp(rho_ratio_coef*(T-T0));(5.30e-2-2.97e-2*log(T/T0))*rho'
+    remxs = 'rho:=exp(rho_ratio_coef*(T-T0));(5.72e-3+1.15e-3*log(T/T0))*rho
+             rho:=exp(rho_ratio_coef*(T-T0));(2.86e-2-1.09e-2*log(T/T0))*rho'
+    fissxs = 'rho:=exp(rho_ratio_coef*(T-T0));(1.30e-3-1.41e-4*log(T/T0))*rho
+              rho:=exp(rho_ratio_coef*(T-T0));(2.18e-2-1.22e-2*log(T/T0))*rho'
+    diffcoef = 'rho:=exp(rho_ratio_coef*(T-T0));(1.43+2.91e-1*log(T/T0))/rho
+                rho:=exp(rho_ratio_coef*(T-T0));(1.26+2.92e-1*log(T/T0))/rho'
+    gtransfxs = 'rho:=exp(rho_ratio_coef*(T-T0));(2.66e-1-5.57e-2*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(1.59e-3+3.90e-3*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(2.02e-3+1.44e-3*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(2.49e-1-5.23e-2*log(T/T0))*rho'
+    recipvel = '9.69e-8+2.18e-8*log(T/T0)
+                2.06e-6-6.95e-7*log(T/T0)'
+    fisse = '${fparse 194e6 * 1.6e-19} ${fparse 194e6 * 1.6e-19}'
+    chi_t = '1 0'
+    chi_p = '1 0'
+    chi_d = '1 0'
+    beta_eff = '2.37e-4 1.54e-3 1.38e-3 2.80e-3 8.26e-4 2.86e-4'
+    decay_constant = '1.24e-2 3.06e-2 1.11e-1 3.02e-1 1.17 3.07'
+    prop_names = 'k cp rho'
+    prop_values = '.0553 1967 2.146e-3'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1e-3
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
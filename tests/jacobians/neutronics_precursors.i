@@ -0,0 +1,97 @@
+# Coupled neutron diffusion, advected delayed neutron precursors and temperature with temperature
+# dependent group constants, for checking the hand coded Jacobian with random initial conditions
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  pre_concs = 'pre1 pre2 pre3 pre4 pre5 pre6'
+  temperature = temp
+  sss2_input = true
+  account_delayed = true
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  jac_test = true
+[]
+
+[Precursors]
+  [pres]
+    var_name_base = pre
+    outlet_boundaries = 'top'
+    u_def = 0
+    v_def = 1
+    w_def = 0
+    nt_exp_form = false
+    loop_precursors = false
+    family = MONOMIAL
+    order = CONSTANT
+    jac_test = true
+  []
+[]
+
+[Variables]
+  [temp]
+  []
+[]
+
+[ICs]
+  [temp_ic]
+    type = RandomIC
+    variable = temp
+    min = 700
+    max = 1100
+  []
+[]
+
+[Kernels]
+  [temp_time_derivative]
+    type = MatINSTemperatureTimeDerivative
+    variable = temp
+  []
+  [temp_diffusion]
+    type = MatDiffusion
+    diffusivity = 'k'
+    variable = temp
+  []
+  [temp_source]
+    type = TransientFissionHeatSource
+    variable = temp
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = MoltresJsonMaterial
+    base_file = '../materials/xsdata.json'
+    material_key = 'fuel'
+    interp_type = 'spline'
+    prop_names = 'k cp rho'
+    prop_values = '.0553 1967 2.146e-3'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1e-3
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
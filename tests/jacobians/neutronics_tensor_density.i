@@ -0,0 +1,88 @@
+# Neutron diffusion with group constants tabulated over the temperature and the salt density, both
+# solved for, for checking the Jacobian entries of the density axis with random initial conditions.
+# The interpolation is multicubic so that the group constants are differentiable at the grid
+# points.
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = temp
+  sss2_input = true
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  xs_variables = density
+  jac_test = true
+[]
+
+[Variables]
+  [temp]
+  []
+  [density]
+  []
+[]
+
+[ICs]
+  [temp_ic]
+    type = RandomIC
+    variable = temp
+    min = 700
+    max = 1100
+  []
+  [density_ic]
+    type = RandomIC
+    variable = density
+    min = 0.92
+    max = 1.08
+  []
+[]
+
+[Kernels]
+  [temp_diffusion]
+    type = Diffusion
+    variable = temp
+  []
+  [density_diffusion]
+    type = Diffusion
+    variable = density
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = MoltresTensorJsonMaterial
+    base_file = '../materials/xsdata_tensor.json'
+    material_key = 'fuel'
+    temperature_axis = 'fuel_temp'
+    axis_variables = 'density'
+    variable_axes = 'density'
+    interpolation = 'multicubic'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1e-3
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
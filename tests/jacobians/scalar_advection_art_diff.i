@@ -0,0 +1,93 @@
+# Artificial diffusion of a scalar advected by a velocity that is solved for, with the boundary
+# term on the outflow boundaries, for checking the Jacobian with respect to the scalar and the
+# velocity components. The velocities span element Peclet numbers on both sides of the
+# approximation of tau used for large Peclet numbers.
+[GlobalParams]
+  use_exp_form = false
+[]
+
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Variables]
+  [c]
+  []
+  [vel_x]
+  []
+  [vel_y]
+  []
+[]
+
+[ICs]
+  [c_ic]
+    type = RandomIC
+    variable = c
+  []
+  [vel_x_ic]
+    type = RandomIC
+    variable = vel_x
+    min = 0.5
+    max = 2
+  []
+  [vel_y_ic]
+    type = RandomIC
+    variable = vel_y
+    min = 0.5
+    max = 2
+  []
+[]
+
+[Kernels]
+  [art_diff]
+    type = ScalarAdvectionArtDiff
+    variable = c
+    u = vel_x
+    v = vel_y
+    diffusivity = diff
+  []
+  [vel_x_diffusion]
+    type = Diffusion
+    variable = vel_x
+  []
+  [vel_y_diffusion]
+    type = Diffusion
+    variable = vel_y
+  []
+[]
+
+[BCs]
+  [no_bc]
+    type = ScalarAdvectionArtDiffNoBCBC
+    variable = c
+    boundary = 'right top'
+    u = vel_x
+    v = vel_y
+    tau = 0.8
+  []
+[]
+
+[Materials]
+  [diff]
+    type = GenericConstantMaterial
+    prop_names = 'diff'
+    prop_values = '0.05'
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
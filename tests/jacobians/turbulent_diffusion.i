@@ -0,0 +1,97 @@
+# Turbulent diffusion of a precursor whose coefficient depends on the Spalart-Allmaras viscosity
+# and on temperature dependent viscosity and density, for checking the automatic differentiation
+# Jacobian with random initial conditions
+[Mesh]
+  [gmg]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 3
+  []
+[]
+
+[Variables]
+  [prec]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [mu_tilde]
+  []
+  [temp]
+  []
+[]
+
+[ICs]
+  [prec_ic]
+    type = RandomIC
+    variable = prec
+  []
+  [mu_tilde_ic]
+    type = RandomIC
+    variable = mu_tilde
+    min = 1
+    max = 20
+  []
+  [temp_ic]
+    type = RandomIC
+    variable = temp
+    min = 700
+    max = 1100
+  []
+[]
+
+[Kernels]
+  [mu_tilde_diffusion]
+    type = Diffusion
+    variable = mu_tilde
+  []
+  [temp_diffusion]
+    type = Diffusion
+    variable = temp
+  []
+[]
+
+[DGKernels]
+  [turbulent_diffusion]
+    type = DGTurbulentDiffusion
+    variable = prec
+    mu_tilde = mu_tilde
+  []
+[]
+
+[BCs]
+  [left]
+    type = PenaltyDirichletBC
+    variable = prec
+    boundary = 'left'
+    value = 1
+    penalty = 1e5
+  []
+[]
+
+[Materials]
+  [mu]
+    type = ADParsedMaterial
+    property_name = mu
+    expression = '1 + 1e-3 * (temp - 900)'
+    coupled_variables = 'temp'
+  []
+  [rho]
+    type = ADParsedMaterial
+    property_name = rho
+    expression = '2 * exp(-1e-4 * (temp - 900))'
+    coupled_variables = 'temp'
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
@@ -0,0 +1,102 @@
+# Gamma heating of the moderator with a cosine shape, given as a function of space and time
+# (default) or as a separable function
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmax = 1
+  ymax = 1
+[]
+
+[Variables]
+  [temp]
+  []
+[]
+
+[AuxVariables]
+  [gamma_heat]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[Functions]
+  [gamma_func]
+    type = ParsedFunction
+    expression = '0.02 * cos(pi * (y - 0.5)) * (1 + t)'
+  []
+  [gamma_shape_func]
+    type = ParsedFunction
+    expression = '0.02 * cos(pi * (y - 0.5))'
+  []
+  [gamma_time_func]
+    type = ParsedFunction
+    expression = '1 + t'
+  []
+[]
+
+[Kernels]
+  [time]
+    type = TimeDerivative
+    variable = temp
+  []
+  [diff]
+    type = Diffusion
+    variable = temp
+  []
+  [gamma]
+    type = GammaHeatSource
+    variable = temp
+    gamma = gamma_func
+    average_fission_heat = average_fission_heat
+  []
+[]
+
+[AuxKernels]
+  [gamma_heat]
+    type = ModeratorHeatSourceTransientAux
+    variable = gamma_heat
+    gamma = gamma_func
+    average_fission_heat = average_fission_heat
+  []
+[]
+
+[BCs]
+  [sides]
+    type = DirichletBC
+    variable = temp
+    boundary = 'left right'
+    value = 0
+  []
+[]
+
+[Postprocessors]
+  [average_fission_heat]
+    type = ConstantPostprocessor
+    value = 100
+    execute_on = 'initial timestep_end'
+  []
+  [average_temp]
+    type = ElementAverageValue
+    variable = temp
+  []
+  [average_gamma_heat]
+    type = ElementAverageValue
+    variable = gamma_heat
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.5
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
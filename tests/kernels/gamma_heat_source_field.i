@@ -0,0 +1,104 @@
+# Gamma heating of the moderator with a cosine shape given as a precomputed field, e.g. from a
+# transport tally
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmax = 1
+  ymax = 1
+[]
+
+[Variables]
+  [temp]
+  []
+[]
+
+[AuxVariables]
+  [gamma_heat]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [gamma_shape]
+  []
+[]
+
+[Functions]
+  [gamma_shape_func]
+    type = ParsedFunction
+    expression = '0.02 * cos(pi * (y - 0.5))'
+  []
+[]
+
+[ICs]
+  [gamma_shape]
+    type = FunctionIC
+    variable = gamma_shape
+    function = gamma_shape_func
+  []
+[]
+
+[Kernels]
+  [time]
+    type = TimeDerivative
+    variable = temp
+  []
+  [diff]
+    type = Diffusion
+    variable = temp
+  []
+  [gamma]
+    type = GammaHeatSource
+    variable = temp
+    gamma_field = gamma_shape
+    average_fission_heat = average_fission_heat
+  []
+[]
+
+[AuxKernels]
+  [gamma_heat]
+    type = ModeratorHeatSourceTransientAux
+    variable = gamma_heat
+    gamma_field = gamma_shape
+    average_fission_heat = average_fission_heat
+  []
+[]
+
+[BCs]
+  [sides]
+    type = DirichletBC
+    variable = temp
+    boundary = 'left right'
+    value = 0
+  []
+[]
+
+[Postprocessors]
+  [average_fission_heat]
+    type = ConstantPostprocessor
+    value = 100
+    execute_on = 'initial timestep_end'
+  []
+  [average_temp]
+    type = ElementAverageValue
+    variable = temp
+  []
+  [average_gamma_heat]
+    type = ElementAverageValue
+    variable = gamma_heat
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.5
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
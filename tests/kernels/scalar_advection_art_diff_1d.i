@@ -0,0 +1,78 @@
+# One-dimensional artificial diffusion with a uniform source and zero
+# Dirichlet boundaries. With h = 1, |u| = 1 and D = 1 the Peclet number is 0.5,
+# tau = coth(0.5) - 2 and the artificial diffusivity is D' = tau / 2. Linear
+# elements are nodally exact for this problem, so
+# phi(x) = x (10 - x) / (2 D'), giving phi(5) = 152.48233891519 and
+# phi(4) = 146.38304535858. In one dimension the streamline diffusion is
+# identical to the isotropic artificial diffusion.
+
+[GlobalParams]
+  use_exp_form = false
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmax = 10
+[]
+
+[Variables]
+  [phi]
+  []
+[]
+
+[Kernels]
+  [art_diff]
+    type = ScalarAdvectionArtDiff
+    variable = phi
+    u_def = 1
+    diffusivity = diff
+  []
+  [source]
+    type = BodyForce
+    variable = phi
+    value = 1
+  []
+[]
+
+[BCs]
+  [dirichlet]
+    type = DirichletBC
+    variable = phi
+    boundary = 'left right'
+    value = 0
+  []
+[]
+
+[Materials]
+  [diff]
+    type = GenericConstantMaterial
+    prop_names = 'diff'
+    prop_values = '1'
+  []
+[]
+
+[Postprocessors]
+  [phi_4]
+    type = PointValue
+    variable = phi
+    point = '4 0 0'
+  []
+  [phi_5]
+    type = PointValue
+    variable = phi
+    point = '5 0 0'
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
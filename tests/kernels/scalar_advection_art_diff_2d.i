@@ -0,0 +1,93 @@
+# Two-dimensional streamline diffusion along a velocity in x, with a source varying in y, zero
+# Dirichlet boundaries on the left and right and no boundary condition on the top and bottom. With
+# square elements of unit size h = 1 and the parameters of scalar_advection_art_diff_1d.i, the
+# streamline diffusion does not act in y and the bilinear elements are nodally exact for
+# phi(x, y) = y x (10 - x) / (2 D'), giving phi(4, 1) = 146.38304535858,
+# phi(5, 1) = 152.48233891519 and phi(5, 0.5) = 76.241169457595. With the isotropic artificial
+# diffusion and a uniform source the solution is instead the one-dimensional one, independent of y.
+
+[GlobalParams]
+  use_exp_form = false
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 1
+  xmax = 10
+  ymax = 1
+[]
+
+[Variables]
+  [phi]
+  []
+[]
+
+[Functions]
+  [source]
+    type = ParsedFunction
+    expression = 'y'
+  []
+[]
+
+[Kernels]
+  [art_diff]
+    type = ScalarAdvectionArtDiff
+    variable = phi
+    u_def = 1
+    diffusivity = diff
+    stabilization = streamline_diffusion
+  []
+  [source]
+    type = BodyForce
+    variable = phi
+    function = source
+  []
+[]
+
+[BCs]
+  [dirichlet]
+    type = DirichletBC
+    variable = phi
+    boundary = 'left right'
+    value = 0
+  []
+[]
+
+[Materials]
+  [diff]
+    type = GenericConstantMaterial
+    prop_names = 'diff'
+    prop_values = '1'
+  []
+[]
+
+[Postprocessors]
+  [phi_4]
+    type = PointValue
+    variable = phi
+    point = '4 1 0'
+  []
+  [phi_5]
+    type = PointValue
+    variable = phi
+    point = '5 1 0'
+  []
+  [phi_5_mid]
+    type = PointValue
+    variable = phi
+    point = '5 0.5 0'
+  []
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,95 @@
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 8
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 922
+  sss2_input = false
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  eigen = true
+[]
+
+[Materials]
+  # Cubic fit in ln(T / 900 K), generated with
+  # python/fit_least_squares_xs.py ../../property_file_dir/msr2g_enrU_two_mat_homogenization_fuel_interp_
+  #   msr2g_enrU_fuel_lsq3.txt --num-groups 2 --num-precursor-groups 8 --degree 3 --log
+  #   --reference-temperature 900
+  [fuel]
+    type = GenericMoltresMaterial
+    property_tables_root = 'msr2g_enrU_fuel_lsq3.txt'
+    interp_type = 'least_squares'
+    lsq_degree = 3
+    lsq_log_temperature = true
+    lsq_reference_temperature = 900
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  initial_eigenvalue = 1
+  nl_abs_tol = 1e-12
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Postprocessors]
+  [k_eff]
+    type = VectorPostprocessorComponent
+    index = 0
+    vectorpostprocessor = k_vpp
+    vector_name = eigen_values_real
+  []
+  [fiss_neutrons]
+    type = ElmIntegTotFissNtsPostprocessor
+    execute_on = linear
+  []
+  [tot_fissions]
+    type = ElmIntegTotFissPostprocessor
+    execute_on = linear
+  []
+  [group1diff]
+    type = ElementL2Diff
+    variable = group1
+    execute_on = 'linear timestep_end'
+    use_displaced_mesh = false
+  []
+[]
+
+[VectorPostprocessors]
+  [k_vpp]
+    type = Eigenvalues
+    inverse_eigenvalue = true
+  []
+[]
+
+[Outputs]
+  perf_graph = true
+  print_linear_residuals = true
+  [out]
+    type = Exodus
+  []
+[]
+
+[Debug]
+  show_var_residual_norms = true
+[]
@@ -0,0 +1,121 @@
+# Samples the least squares group constants of gmm_least_squares.i between the temperature
+# branches of the tables they were fitted to. The temperature is constant on each element, x + 900
+# at the element centroids: 925, 1125, 1375 and 1675 K. With the tables and interp_type=linear or
+# spline, the same input gives the interpolated values.
+
+[Mesh]
+  [mesh]
+    type = CartesianMeshGenerator
+    dim = 1
+    dx = '50 350 150 450'
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [temp]
+    family = MONOMIAL
+    order = CONSTANT
+    [InitialCondition]
+      type = FunctionIC
+      function = 'x + 900'
+    []
+  []
+  [remxs1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [remxs2]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [nsf1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [nsf2]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [diffcoef1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [diffcoef2]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [remxs1]
+    type = MaterialStdVectorAux
+    variable = remxs1
+    property = remxs
+    index = 0
+  []
+  [remxs2]
+    type = MaterialStdVectorAux
+    variable = remxs2
+    property = remxs
+    index = 1
+  []
+  [nsf1]
+    type = MaterialStdVectorAux
+    variable = nsf1
+    property = nsf
+    index = 0
+  []
+  [nsf2]
+    type = MaterialStdVectorAux
+    variable = nsf2
+    property = nsf
+    index = 1
+  []
+  [diffcoef1]
+    type = MaterialStdVectorAux
+    variable = diffcoef1
+    property = diffcoef
+    index = 0
+  []
+  [diffcoef2]
+    type = MaterialStdVectorAux
+    variable = diffcoef2
+    property = diffcoef
+    index = 1
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = GenericMoltresMaterial
+    num_groups = 2
+    num_precursor_groups = 8
+    temperature = temp
+    sss2_input = false
+    property_tables_root = 'msr2g_enrU_fuel_lsq3.txt'
+    interp_type = 'least_squares'
+    lsq_degree = 3
+    lsq_log_temperature = true
+    lsq_reference_temperature = 900
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[VectorPostprocessors]
+  [values]
+    type = ElementValueSampler
+    variable = 'remxs1 remxs2 nsf1 nsf2 diffcoef1 diffcoef2'
+    sort_by = id
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
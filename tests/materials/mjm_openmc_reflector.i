@@ -0,0 +1,120 @@
+# Samples the group constants of the reflector of godiva_mgxs.h5, which is not fissionable but has
+# delayed data. The temperature is constant on each element, so the elemental averages of the
+# properties are the values interpolated between the 900 K and 1200 K data.
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 2
+    xmin = 900
+    xmax = 1200
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [temp]
+    family = MONOMIAL
+    order = CONSTANT
+    [InitialCondition]
+      type = FunctionIC
+      function = 'x'
+    []
+  []
+  [remxs1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [diffcoef6]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [nsf1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [beta_eff1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [chi_d3]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [decay_constant1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [remxs1]
+    type = MaterialStdVectorAux
+    variable = remxs1
+    property = remxs
+    index = 0
+  []
+  [diffcoef6]
+    type = MaterialStdVectorAux
+    variable = diffcoef6
+    property = diffcoef
+    index = 5
+  []
+  [nsf1]
+    type = MaterialStdVectorAux
+    variable = nsf1
+    property = nsf
+    index = 0
+  []
+  [beta_eff1]
+    type = MaterialStdVectorAux
+    variable = beta_eff1
+    property = beta_eff
+    index = 0
+  []
+  [chi_d3]
+    type = MaterialStdVectorAux
+    variable = chi_d3
+    property = chi_d
+    index = 2
+  []
+  [decay_constant1]
+    type = MaterialStdVectorAux
+    variable = decay_constant1
+    property = decay_constant
+    index = 0
+  []
+[]
+
+[Materials]
+  [reflector]
+    type = MoltresJsonMaterial
+    num_groups = 6
+    num_precursor_groups = 8
+    temperature = temp
+    xs_format = openmc
+    base_file = 'godiva_mgxs.h5'
+    material_key = 'reflector'
+    interp_type = 'linear'
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[VectorPostprocessors]
+  [values]
+    type = ElementValueSampler
+    variable = 'remxs1 diffcoef6 nsf1 beta_eff1 chi_d3 decay_constant1'
+    sort_by = id
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
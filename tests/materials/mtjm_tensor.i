@@ -0,0 +1,105 @@
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = temp
+  sss2_input = true
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 4
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  eigen = true
+[]
+
+[AuxVariables]
+  [temp]
+  []
+  [density]
+  []
+[]
+
+[ICs]
+  [temp]
+    type = FunctionIC
+    variable = temp
+    function = '700 + 400 * x'
+  []
+  [density]
+    type = FunctionIC
+    variable = density
+    function = '1.05 - 0.1 * y'
+  []
+[]
+
+[Materials]
+  # The fuel temperature and the relative salt density axes of the grid are given by the
+  # temperature and by the density variable
+  [fuel]
+    type = MoltresTensorJsonMaterial
+    base_file = 'xsdata_tensor.json'
+    material_key = 'fuel'
+    temperature_axis = 'fuel_temp'
+    axis_variables = 'density'
+    variable_axes = 'density'
+    interpolation = 'multilinear'
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  initial_eigenvalue = 1
+  nl_abs_tol = 1e-12
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Postprocessors]
+  [k_eff]
+    type = VectorPostprocessorComponent
+    index = 0
+    vectorpostprocessor = k_vpp
+    vector_name = eigen_values_real
+  []
+  [fiss_neutrons]
+    type = ElmIntegTotFissNtsPostprocessor
+    execute_on = linear
+  []
+  [tot_fissions]
+    type = ElmIntegTotFissPostprocessor
+    execute_on = linear
+  []
+[]
+
+[VectorPostprocessors]
+  [k_vpp]
+    type = Eigenvalues
+    inverse_eigenvalue = true
+  []
+[]
+
+[Outputs]
+  perf_graph = true
+  [out]
+    type = Exodus
+  []
+[]
@@ -0,0 +1,123 @@
+# Samples the group constants of xsdata_tensor.json and their derivatives between the grid points.
+# The temperature and the density are constant on each element, x and y at the element centroids,
+# so the elemental averages of the properties are the interpolated values.
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 3
+    ny = 2
+    xmin = 650
+    xmax = 1250
+    ymin = 0.85
+    ymax = 1.15
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [temp]
+    family = MONOMIAL
+    order = CONSTANT
+    [InitialCondition]
+      type = FunctionIC
+      function = 'x'
+    []
+  []
+  [density]
+    family = MONOMIAL
+    order = CONSTANT
+    [InitialCondition]
+      type = FunctionIC
+      function = 'y'
+    []
+  []
+  [remxs1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [diffcoef1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [d_diffcoef1_d_temp]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [d_diffcoef1_d_density]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [nsf2]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [remxs1]
+    type = MaterialStdVectorAux
+    variable = remxs1
+    property = remxs
+    index = 0
+  []
+  [diffcoef1]
+    type = MaterialStdVectorAux
+    variable = diffcoef1
+    property = diffcoef
+    index = 0
+  []
+  [d_diffcoef1_d_temp]
+    type = MaterialStdVectorAux
+    variable = d_diffcoef1_d_temp
+    property = d_diffcoef_d_temp
+    index = 0
+  []
+  [d_diffcoef1_d_density]
+    type = MaterialStdVectorAux
+    variable = d_diffcoef1_d_density
+    property = d_diffcoef_d_density
+    index = 0
+  []
+  [nsf2]
+    type = MaterialStdVectorAux
+    variable = nsf2
+    property = nsf
+    index = 1
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = MoltresTensorJsonMaterial
+    num_groups = 2
+    num_precursor_groups = 6
+    temperature = temp
+    base_file = 'xsdata_tensor.json'
+    material_key = 'fuel'
+    temperature_axis = 'fuel_temp'
+    axis_variables = 'density'
+    variable_axes = 'density'
+    interpolation = 'multilinear'
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[VectorPostprocessors]
+  [values]
+    type = ElementValueSampler
+    variable = 'remxs1 diffcoef1 d_diffcoef1_d_temp d_diffcoef1_d_density nsf2'
+    sort_by = id
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,109 @@
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 950
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  eigen = true
+[]
+
+[Materials]
+  # Logarithmic temperature fits of the MSRE fuel salt with the density variation of the salt,
+  # as in MsreFuelTwoGrpXSFunctionMaterial. Whitespace separates the expressions of the groups.
+  [fuel]
+    type = ParsedXSMaterial
+    constant_names = 'T0 rho_ratio_coef'
+    constant_expressions = '922 ${fparse -1.8 * 1.18e-4}'
+    nsf = 'rho:=exp(rho_ratio_coef*(T-T0));(3.18e-3-3.46e-4*log(T/T0))*rho
+           rho:=exp(rho_ratio_coef*(T-T0));(5.30e-2-2.97e-2*log(T/T0))*rho'
+    remxs = 'rho:=exp(rho_ratio_coef*(T-T0));(5.72e-3+1.15e-3*log(T/T0))*rho
+             rho:=exp(rho_ratio_coef*(T-T0));(2.86e-2-1.09e-2*log(T/T0))*rho'
+    fissxs = 'rho:=exp(rho_ratio_coef*(T-T0));(1.30e-3-1.41e-4*log(T/T0))*rho
+              rho:=exp(rho_ratio_coef*(T-T0));(2.18e-2-1.22e-2*log(T/T0))*rho'
+    diffcoef = 'rho:=exp(rho_ratio_coef*(T-T0));(1.43+2.91e-1*log(T/T0))/rho
+                rho:=exp(rho_ratio_coef*(T-T0));(1.26+2.92e-1*log(T/T0))/rho'
+    gtransfxs = 'rho:=exp(rho_ratio_coef*(T-T0));(2.66e-1-5.57e-2*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(1.59e-3+3.90e-3*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(2.02e-3+1.44e-3*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(2.49e-1-5.23e-2*log(T/T0))*rho'
+    recipvel = '9.69e-8+2.18e-8*log(T/T0)
+                2.06e-6-6.95e-7*log(T/T0)'
+    fisse = '${fparse 194e6 * 1.6e-19} ${fparse 194e6 * 1.6e-19}'
+    chi_t = '1 0'
+    chi_p = '1 0'
+    chi_d = '1 0'
+    beta_eff = '2.37e-4 1.54e-3 1.38e-3 2.80e-3 8.26e-4 2.86e-4'
+    decay_constant = '1.24e-2 3.06e-2 1.11e-1 3.02e-1 1.17 3.07'
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  initial_eigenvalue = 1
+  nl_abs_tol = 1e-12
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Postprocessors]
+  [k_eff]
+    type = VectorPostprocessorComponent
+    index = 0
+    vectorpostprocessor = k_vpp
+    vector_name = eigen_values_real
+  []
+  [fiss_neutrons]
+    type = ElmIntegTotFissNtsPostprocessor
+    execute_on = linear
+  []
+  [tot_fissions]
+    type = ElmIntegTotFissPostprocessor
+    execute_on = linear
+  []
+  [group1diff]
+    type = ElementL2Diff
+    variable = group1
+    execute_on = 'linear timestep_end'
+    use_displaced_mesh = false
+  []
+[]
+
+[VectorPostprocessors]
+  [k_vpp]
+    type = Eigenvalues
+    inverse_eigenvalue = true
+  []
+[]
+
+[Outputs]
+  perf_graph = true
+  print_linear_residuals = true
+  [out]
+    type = Exodus
+  []
+[]
+
+[Debug]
+  show_var_residual_norms = true
+[]
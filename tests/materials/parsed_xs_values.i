@@ -0,0 +1,184 @@
+# Samples group constants and temperature derivatives of parsed_xs.i at three temperatures. The
+# temperature is constant on each element, x at the element centroids, so the elemental averages of
+# the properties are the values at that temperature. With Materials/active=msre, the same
+# properties come from MsreFuelTwoGrpXSFunctionMaterial, whose fits the expressions reproduce.
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 1
+    nx = 3
+    xmin = 800
+    xmax = 1100
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [temp]
+    family = MONOMIAL
+    order = CONSTANT
+    [InitialCondition]
+      type = FunctionIC
+      function = 'x'
+    []
+  []
+  [nsf1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [remxs2]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [diffcoef1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [gtransfxs2]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [recipvel2]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [d_nsf1_d_temp]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [d_remxs2_d_temp]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [d_diffcoef1_d_temp]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [d_gtransfxs2_d_temp]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+  [d_recipvel2_d_temp]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [nsf1]
+    type = MaterialStdVectorAux
+    variable = nsf1
+    property = nsf
+    index = 0
+  []
+  [remxs2]
+    type = MaterialStdVectorAux
+    variable = remxs2
+    property = remxs
+    index = 1
+  []
+  [diffcoef1]
+    type = MaterialStdVectorAux
+    variable = diffcoef1
+    property = diffcoef
+    index = 0
+  []
+  [gtransfxs2]
+    type = MaterialStdVectorAux
+    variable = gtransfxs2
+    property = gtransfxs
+    index = 1
+  []
+  [recipvel2]
+    type = MaterialStdVectorAux
+    variable = recipvel2
+    property = recipvel
+    index = 1
+  []
+  [d_nsf1_d_temp]
+    type = MaterialStdVectorAux
+    variable = d_nsf1_d_temp
+    property = d_nsf_d_temp
+    index = 0
+  []
+  [d_remxs2_d_temp]
+    type = MaterialStdVectorAux
+    variable = d_remxs2_d_temp
+    property = d_remxs_d_temp
+    index = 1
+  []
+  [d_diffcoef1_d_temp]
+    type = MaterialStdVectorAux
+    variable = d_diffcoef1_d_temp
+    property = d_diffcoef_d_temp
+    index = 0
+  []
+  [d_gtransfxs2_d_temp]
+    type = MaterialStdVectorAux
+    variable = d_gtransfxs2_d_temp
+    property = d_gtransfxs_d_temp
+    index = 1
+  []
+  [d_recipvel2_d_temp]
+    type = MaterialStdVectorAux
+    variable = d_recipvel2_d_temp
+    property = d_recipvel_d_temp
+    index = 1
+  []
+[]
+
+[Materials]
+  active = 'fuel'
+  [fuel]
+    type = ParsedXSMaterial
+    num_groups = 2
+    num_precursor_groups = 6
+    temperature = temp
+    constant_names = 'T0 rho_ratio_coef'
+    constant_expressions = '922 ${fparse -1.8 * 1.18e-4}'
+    nsf = 'rho:=exp(rho_ratio_coef*(T-T0));(3.18e-3-3.46e-4*log(T/T0))*rho
+           rho:=exp(rho_ratio_coef*(T-T0));(5.30e-2-2.97e-2*log(T/T0))*rho'
+    remxs = 'rho:=exp(rho_ratio_coef*(T-T0));(5.72e-3+1.15e-3*log(T/T0))*rho
+             rho:=exp(rho_ratio_coef*(T-T0));(2.86e-2-1.09e-2*log(T/T0))*rho'
+    fissxs = 'rho:=exp(rho_ratio_coef*(T-T0));(1.30e-3-1.41e-4*log(T/T0))*rho
+              rho:=exp(rho_ratio_coef*(T-T0));(2.18e-2-1.22e-2*log(T/T0))*rho'
+    diffcoef = 'rho:=exp(rho_ratio_coef*(T-T0));(1.43+2.91e-1*log(T/T0))/rho
+                rho:=exp(rho_ratio_coef*(T-T0));(1.26+2.92e-1*log(T/T0))/rho'
+    gtransfxs = 'rho:=exp(rho_ratio_coef*(T-T0));(2.66e-1-5.57e-2*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(1.59e-3+3.90e-3*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(2.02e-3+1.44e-3*log(T/T0))*rho
+                 rho:=exp(rho_ratio_coef*(T-T0));(2.49e-1-5.23e-2*log(T/T0))*rho'
+    recipvel = '9.69e-8+2.18e-8*log(T/T0)
+                2.06e-6-6.95e-7*log(T/T0)'
+    fisse = '${fparse 194e6 * 1.6e-19} ${fparse 194e6 * 1.6e-19}'
+    chi_t = '1 0'
+    chi_p = '1 0'
+    chi_d = '1 0'
+    beta_eff = '2.37e-4 1.54e-3 1.38e-3 2.80e-3 8.26e-4 2.86e-4'
+    decay_constant = '1.24e-2 3.06e-2 1.11e-1 3.02e-1 1.17 3.07'
+  []
+  [msre]
+    type = MsreFuelTwoGrpXSFunctionMaterial
+    temperature = temp
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[VectorPostprocessors]
+  [values]
+    type = ElementValueSampler
+    variable = 'nsf1 remxs2 diffcoef1 gtransfxs2 recipvel2 d_nsf1_d_temp d_remxs2_d_temp d_diffcoef1_d_temp d_gtransfxs2_d_temp d_recipvel2_d_temp'
+    sort_by = id
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,106 @@
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 922
+  sss2_input = false
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 8
+    ny = 8
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  eigen = true
+[]
+
+[AuxScalarVariables]
+  [rod1]
+    initial_condition = 0.55
+  []
+  [rod2]
+    initial_condition = 0.8
+  []
+[]
+
+[Materials]
+  # Two rods along y in the columns of elements 0.25 < x < 0.375 and 0.625 < x < 0.75. The rod
+  # tips end inside elements, which are partially rodded.
+  [fuel]
+    type = RoddedMaterial
+    property_tables_root = '../../property_file_dir/newt_fuel_'
+    interp_type = 'linear'
+    rodDimension = 'y'
+    rodPosition = 'rod1 rod2'
+    rod_centers = '0.3125 0 0 0.6875 0 0'
+    rod_radii = 0.05
+    absorb_factor = '5 10'
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  initial_eigenvalue = 1
+  nl_abs_tol = 1e-12
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Postprocessors]
+  [k_eff]
+    type = VectorPostprocessorComponent
+    index = 0
+    vectorpostprocessor = k_vpp
+    vector_name = eigen_values_real
+  []
+  [fiss_neutrons]
+    type = ElmIntegTotFissNtsPostprocessor
+    execute_on = linear
+  []
+  [tot_fissions]
+    type = ElmIntegTotFissPostprocessor
+    execute_on = linear
+  []
+  [group1diff]
+    type = ElementL2Diff
+    variable = group1
+    execute_on = 'linear timestep_end'
+    use_displaced_mesh = false
+  []
+[]
+
+[VectorPostprocessors]
+  [k_vpp]
+    type = Eigenvalues
+    inverse_eigenvalue = true
+  []
+[]
+
+[Outputs]
+  perf_graph = true
+  print_linear_residuals = true
+  [out]
+    type = Exodus
+  []
+[]
+
+[Debug]
+  show_var_residual_norms = true
+[]
@@ -0,0 +1,97 @@
+# Samples the group 1 removal cross section of RoddedMaterial in unrodded, partially rodded and
+# rodded elements of the two rod columns of rodded_material.i. At 900 K the unrodded value is the
+# tabulated 0.01100575.
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 8
+    ny = 8
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxScalarVariables]
+  [rod1]
+    initial_condition = 0.55
+  []
+  [rod2]
+    initial_condition = 0.8
+  []
+[]
+
+[AuxVariables]
+  [remxs1]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [remxs1]
+    type = MaterialStdVectorAux
+    variable = remxs1
+    property = remxs
+    index = 0
+  []
+[]
+
+[Materials]
+  [fuel]
+    type = RoddedMaterial
+    num_groups = 2
+    num_precursor_groups = 6
+    temperature = 900
+    property_tables_root = '../../property_file_dir/newt_fuel_'
+    interp_type = 'linear'
+    rodDimension = 'y'
+    rodPosition = 'rod1 rod2'
+    rod_centers = '0.3125 0 0 0.6875 0 0'
+    rod_radii = 0.05
+    absorb_factor = '5 10'
+  []
+[]
+
+[Executioner]
+  type = Steady
+  # Two quadrature points along the rods, one on each side of the binary cut at the rod tips
+  [Quadrature]
+    type = GAUSS
+    order = SECOND
+  []
+[]
+
+[Postprocessors]
+  # Rod 1 column, below the tip
+  [unrodded]
+    type = ElementalVariableValue
+    variable = remxs1
+    elementid = 2
+  []
+  # Rod 1 tip at 0.55 in 0.5 < y < 0.625
+  [partial_rod1]
+    type = ElementalVariableValue
+    variable = remxs1
+    elementid = 34
+  []
+  # Rod 1 column, above the tip
+  [rodded]
+    type = ElementalVariableValue
+    variable = remxs1
+    elementid = 58
+  []
+  # Rod 2 tip at 0.8 in 0.75 < y < 0.875
+  [partial_rod2]
+    type = ElementalVariableValue
+    variable = remxs1
+    elementid = 53
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,68 @@
+# Block volumes, sideset areas and sizes of a generated 3D lattice of 3 by 3 fuel channels, for
+# comparison with their exact values
+R = 72.5
+num_channels = 3
+pitch = ${fparse R / 14}
+
+[Mesh]
+  [lattice]
+    type = MSRLatticeMeshGenerator
+    dim = 3
+    num_channels = ${num_channels}
+    pitch = ${pitch}
+    fuel_width = ${fparse 0.237952211 * pitch}
+    height = ${fparse 2 * R + 5}
+    nx_fuel = 2
+    nx_moder = 2
+    n_axial = 10
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Postprocessors]
+  [fuel_volume]
+    type = VolumePostprocessor
+    block = fuel
+  []
+  [moder_volume]
+    type = VolumePostprocessor
+    block = moder
+  []
+  [fuel_tops_area]
+    type = AreaPostprocessor
+    boundary = fuel_tops
+  []
+  [fuel_bottoms_area]
+    type = AreaPostprocessor
+    boundary = fuel_bottoms
+  []
+  [moder_tops_area]
+    type = AreaPostprocessor
+    boundary = moder_tops
+  []
+  [moder_bottoms_area]
+    type = AreaPostprocessor
+    boundary = moder_bottoms
+  []
+  [outer_wall_area]
+    type = AreaPostprocessor
+    boundary = outer_wall
+  []
+  [num_elems]
+    type = NumElems
+  []
+  [num_nodes]
+    type = NumNodes
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
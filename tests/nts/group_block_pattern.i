@@ -0,0 +1,52 @@
+# Two group neutron diffusion on a 2x2 mesh of first order elements. Each group flux block of the
+# Jacobian has 49 nonzeros, so the preconditioning matrix has 98 nonzeros with the group blocks
+# only and 196 with the groups fully coupled.
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 900
+  sss2_input = true
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 2
+    ny = 2
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  vacuum_boundaries = 'left right top bottom'
+  create_temperature_var = false
+[]
+
+[Materials]
+  [fuel]
+    type = MoltresJsonMaterial
+    base_file = '../materials/xsdata.json'
+    material_key = 'fuel'
+    interp_type = 'linear'
+  []
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1e-3
+  solve_type = 'PJFNK'
+  petsc_options = '-ksp_view_pmat ::ascii_info'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
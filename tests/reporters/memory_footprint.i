@@ -0,0 +1,82 @@
+[GlobalParams]
+  num_groups = 2
+  num_precursor_groups = 6
+  use_exp_form = false
+  group_fluxes = 'group1 group2'
+  temperature = 922
+  sss2_input = false
+  account_delayed = false
+[]
+
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 10
+    ny = 10
+  []
+  [moder]
+    type = SubdomainBoundingBoxGenerator
+    input = mesh
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+    block_id = 1
+    block_name = moder
+  []
+  [fuel]
+    type = RenameBlockGenerator
+    input = moder
+    old_block = 0
+    new_block = fuel
+  []
+[]
+
+[Nt]
+  var_name_base = group
+  create_temperature_var = false
+  eigen = true
+[]
+
+[Materials]
+  [fuel]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_fuel_'
+    interp_type = 'spline'
+    block = 'fuel'
+  []
+  [moder]
+    type = GenericMoltresMaterial
+    property_tables_root = '../../property_file_dir/newt_msre_mod_'
+    interp_type = 'spline'
+    block = 'moder'
+  []
+[]
+
+[Executioner]
+  type = Eigenvalue
+  initial_eigenvalue = 1
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Preconditioning]
+  [SMP]
+    type = SMP
+    full = true
+  []
+[]
+
+[Reporters]
+  [memory]
+    type = MemoryFootprintReporter
+    execute_on = 'initial timestep_end'
+  []
+[]
+
+[Outputs]
+  [out]
+    type = JSON
+    execute_on = 'initial timestep_end'
+  []
+[]
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "MooseApp.h"
+#include "FEProblem.h"
+#include "MooseMesh.h"
+
+class KernelBase;
+class MaterialBase;
+
+/**
+ * Builds a problem on a single synthetic element that holds the Moltres objects under test, so
+ * that material and kernel hot paths can be timed in isolation from mesh loops, solvers and
+ * output. Synthetic group constant libraries with any number of neutron groups are written to a
+ * scratch directory so that every interp_type can be exercised.
+ */
+class MoltresBenchmarkProblem
+{
+public:
+  /**
+   * @param elem_type The libMesh element type of the single element, e.g. QUAD4 or HEX27
+   * @param num_groups The number of neutron energy groups
+   * @param num_precursor_groups The number of delayed neutron precursor groups
+   */
+  MoltresBenchmarkProblem(const std::string & elem_type,
+                          unsigned int num_groups,
+                          unsigned int num_precursor_groups);
+
+  /// Adds a nonlinear variable of the given family and order
+  void addVariable(const std::string & name,
+                   const std::string & family = "LAGRANGE",
+                   const std::string & order = "FIRST");
+
+  /// Adds the Lagrange group flux variables group1 ... groupN of the given order
+  void addGroupFluxes(const std::string & order = "FIRST");
+
+  /// Adds the constant monomial precursor concentration variables pre1 ... preN
+  void addPrecursors();
+
+  /**
+   * Writes a synthetic group constant library for the requested interpolation type and adds a
+   * GenericMoltresMaterial that reads it.
+   */
+  void addNuclearMaterial(const std::string & interp_type);
+
+  /// Adds a kernel with the given parameters acting on the given variable
+  void addKernel(const std::string & type,
+                 const std::string & name,
+                 InputParameters & params,
+                 const std::string & variable);
+
+  /// Sets up quadrature, initializes the equation systems and fills the solution with ones
+  void init();
+
+  /// Prepares assembly, variable values and material properties on the element
+  void reinit();
+
+  /// Computes the material properties of the material named "xs" on the element
+  void computeMaterialProperties();
+
+  FEProblem & problem() { return *_fe_problem; }
+  Factory & factory() { return _factory; }
+  KernelBase & kernel(const std::string & name);
+  unsigned int variableNumber(const std::string & name);
+  const std::vector<VariableName> & groupFluxNames() const { return _group_flux_names; }
+  const std::vector<VariableName> & precursorNames() const { return _precursor_names; }
+  unsigned int numGroups() const { return _num_groups; }
+  unsigned int numPrecursorGroups() const { return _num_precursor_groups; }
+
+protected:
+  /// Writes the temperature-dependent tables read by interp_type = spline/linear/...
+  std::string writeTemperatureTables();
+  /// Writes the two-temperature tables read by interp_type = bicubic
+  std::string writeBicubicTables();
+  /// Writes the fit coefficients read by interp_type = least_squares
+  std::string writeLeastSquaresFile();
+
+  /// Synthetic value of group constant entry k at temperature T
+  Real xsValue(const std::string & xs_name, unsigned int k, Real T) const;
+  /// Number of entries of a group constant
+  unsigned int xsLength(const std::string & xs_name) const;
+
+  std::shared_ptr<MooseApp> _app;
+  Factory & _factory;
+  std::unique_ptr<MooseMesh> _mesh;
+  std::shared_ptr<FEProblem> _fe_problem;
+  const Elem * _elem;
+
+  unsigned int _num_groups;
+  unsigned int _num_precursor_groups;
+  std::vector<VariableName> _group_flux_names;
+  std::vector<VariableName> _precursor_names;
+  std::string _scratch_dir;
+  std::vector<Real> _temperatures;
+  std::shared_ptr<MaterialBase> _material;
+};